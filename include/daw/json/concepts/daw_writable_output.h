@@ -17,6 +17,7 @@
 #include <daw/daw_character_traits.h>
 #include <daw/daw_string_view.h>
 
+#include <cstddef>
 #include <cstdio>
 #include <iostream>
 #include <string>
@@ -288,5 +289,29 @@ namespace daw::json {
 				}
 			};
 		} // namespace concepts
+
+		/// @brief A writable output that only counts the characters written to
+		/// it.  Serializing to it first gives the exact size of the output
+		struct output_size_counter {
+			std::size_t size = 0;
+		};
+
+		namespace concepts {
+			/// @brief Specialization for counting the size of the output
+			template<>
+			struct writable_output_trait<output_size_counter> : std::true_type {
+
+				template<typename... StringViews>
+				static constexpr void write( output_size_counter &out,
+				                             StringViews const &...svs ) {
+					static_assert( sizeof...( StringViews ) > 0 );
+					out.size += ( std::size( svs ) + ... );
+				}
+
+				static constexpr void put( output_size_counter &out, char ) {
+					++out.size;
+				}
+			};
+		} // namespace concepts
 	}   // namespace DAW_JSON_VER
 } // namespace daw::json
@@ -22,6 +22,24 @@
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief Parse the document with parse_document.  When parsing with
+			/// options::ErrorContext::yes, a json_exception leaving it records the
+			/// document start so that the line/column of the error can be found
+			template<typename ParseState, typename Func>
+			DAW_ATTRIB_INLINE constexpr decltype( auto )
+			with_document_context( char const *doc_start, Func &&parse_document ) {
+				if constexpr( ParseState::track_error_context ) {
+					return invoke_with_error_context(
+					  DAW_FWD( parse_document ), [doc_start]( json_exception &jex ) {
+						  jex.set_document_start( doc_start );
+					  } );
+				} else {
+					(void)doc_start;
+					return DAW_FWD( parse_document )( );
+				}
+			}
+		} // namespace json_details
 
 		/// @brief Construct the JSONMember from the JSON document argument.
 		/// @tparam JsonMember any bool, arithmetic, string, string_view,
@@ -68,17 +86,21 @@ namespace daw::json {
 			auto parse_state =
 			  ParseState( std::data( json_data ), daw::data_end( json_data ) );
 
-			if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
-				auto result = json_details::parse_value<json_member, KnownBounds>(
-				  parse_state, ParseTag<json_member::expected_type>{ } );
-				parse_state.trim_left( );
-				daw_json_ensure( parse_state.empty( ), ErrorReason::InvalidEndOfValue,
-				                 parse_state );
-				return result;
-			} else {
-				return json_details::parse_value<json_member, KnownBounds>(
-				  parse_state, ParseTag<json_member::expected_type>{ } );
-			}
+			return json_details::with_document_context<ParseState>(
+			  std::data( json_data ), [&]( ) {
+				if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
+					auto result =
+					  json_details::parse_value<json_member, KnownBounds>(
+					    parse_state, ParseTag<json_member::expected_type>{ } );
+					parse_state.trim_left( );
+					daw_json_ensure( parse_state.empty( ),
+					                 ErrorReason::InvalidEndOfValue, parse_state );
+					return result;
+				} else {
+					return json_details::parse_value<json_member, KnownBounds>(
+					  parse_state, ParseTag<json_member::expected_type>{ } );
+				}
+			  } );
 		}
 
 		/// @brief Construct the JSONMember from the JSON document argument.
@@ -145,17 +167,21 @@ namespace daw::json {
 			  options::TemporarilyMutateBuffer::no>;
 
 			auto parse_state = ParseState::with_allocator( f, l, a );
-			if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
-				auto result = json_details::parse_value<json_member, KnownBounds>(
-				  parse_state, ParseTag<json_member::expected_type>{ } );
-				parse_state.trim_left( );
-				daw_json_ensure( parse_state.empty( ), ErrorReason::InvalidEndOfValue,
-				                 parse_state );
-				return result;
-			} else {
-				return json_details::parse_value<json_member, KnownBounds>(
-				  parse_state, ParseTag<json_member::expected_type>{ } );
-			}
+			return json_details::with_document_context<ParseState>(
+			  std::data( json_data ), [&]( ) {
+				if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
+					auto result =
+					  json_details::parse_value<json_member, KnownBounds>(
+					    parse_state, ParseTag<json_member::expected_type>{ } );
+					parse_state.trim_left( );
+					daw_json_ensure( parse_state.empty( ),
+					                 ErrorReason::InvalidEndOfValue, parse_state );
+					return result;
+				} else {
+					return json_details::parse_value<json_member, KnownBounds>(
+					  parse_state, ParseTag<json_member::expected_type>{ } );
+				}
+			  } );
 		}
 
 		/// @brief Construct the JSONMember from the JSON document argument.
@@ -238,17 +264,21 @@ namespace daw::json {
 				daw_json_ensure( jv, ErrorReason::JSONPathNotFound );
 			}
 			auto parse_state = jv.get_raw_state( );
-			if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
-				auto result = json_details::parse_value<json_member, KnownBounds>(
-				  parse_state, ParseTag<json_member::expected_type>{ } );
-				parse_state.trim_left( );
-				daw_json_ensure( parse_state.empty( ), ErrorReason::InvalidEndOfValue,
-				                 parse_state );
-				return result;
-			} else {
-				return json_details::parse_value<json_member, KnownBounds>(
-				  parse_state, ParseTag<json_member::expected_type>{ } );
-			}
+			return json_details::with_document_context<ParseState>(
+			  std::data( json_data ), [&]( ) {
+				if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
+					auto result =
+					  json_details::parse_value<json_member, KnownBounds>(
+					    parse_state, ParseTag<json_member::expected_type>{ } );
+					parse_state.trim_left( );
+					daw_json_ensure( parse_state.empty( ),
+					                 ErrorReason::InvalidEndOfValue, parse_state );
+					return result;
+				} else {
+					return json_details::parse_value<json_member, KnownBounds>(
+					  parse_state, ParseTag<json_member::expected_type>{ } );
+				}
+			  } );
 		}
 
 		/// @brief Parse a JSONMember from the json_data starting at member_path.
@@ -335,17 +365,21 @@ namespace daw::json {
 				daw_json_ensure( jv, ErrorReason::JSONPathNotFound );
 			}
 			auto parse_state = jv.get_raw_state( );
-			if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
-				auto result = json_details::parse_value<json_member, KnownBounds>(
-				  parse_state, ParseTag<json_member::expected_type>{ } );
-				parse_state.trim_left( );
-				daw_json_ensure( parse_state.empty( ), ErrorReason::InvalidEndOfValue,
-				                 parse_state );
-				return result;
-			} else {
-				return json_details::parse_value<json_member, KnownBounds>(
-				  parse_state, ParseTag<json_member::expected_type>{ } );
-			}
+			return json_details::with_document_context<ParseState>(
+			  std::data( json_data ), [&]( ) {
+				if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
+					auto result =
+					  json_details::parse_value<json_member, KnownBounds>(
+					    parse_state, ParseTag<json_member::expected_type>{ } );
+					parse_state.trim_left( );
+					daw_json_ensure( parse_state.empty( ),
+					                 ErrorReason::InvalidEndOfValue, parse_state );
+					return result;
+				} else {
+					return json_details::parse_value<json_member, KnownBounds>(
+					  parse_state, ParseTag<json_member::expected_type>{ } );
+				}
+			  } );
 		}
 
 		/// @brief Parse a JSONMember from the json_data starting at member_path.
@@ -545,17 +579,21 @@ namespace daw::json {
 			daw_json_assert_weak( parse_state.is_opening_bracket_checked( ),
 			                      ErrorReason::InvalidArrayStart, parse_state );
 #endif
-			if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
-				auto result =
-				  json_details::parse_value_array<parser_t, KnownBounds>( parse_state );
-				parse_state.trim_left( );
-				daw_json_ensure( parse_state.empty( ), ErrorReason::InvalidEndOfValue,
-				                 parse_state );
-				return result;
-			} else {
-				return json_details::parse_value_array<parser_t, KnownBounds>(
-				  parse_state );
-			}
+			return json_details::with_document_context<ParseState>(
+			  std::data( json_data ), [&]( ) {
+				if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
+					auto result =
+					  json_details::parse_value_array<parser_t, KnownBounds>(
+					    parse_state );
+					parse_state.trim_left( );
+					daw_json_ensure( parse_state.empty( ),
+					                 ErrorReason::InvalidEndOfValue, parse_state );
+					return result;
+				} else {
+					return json_details::parse_value_array<parser_t, KnownBounds>(
+					  parse_state );
+				}
+			  } );
 		}
 
 		/// @brief Parse JSON data where the root item is an array
@@ -654,17 +692,21 @@ namespace daw::json {
 			daw_json_assert_weak( parse_state.is_opening_bracket_checked( ),
 			                      ErrorReason::InvalidArrayStart, parse_state );
 #endif
-			if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
-				auto result =
-				  json_details::parse_value_array<parser_t, KnownBounds>( parse_state );
-				parse_state.trim_left( );
-				daw_json_ensure( parse_state.empty( ), ErrorReason::InvalidEndOfValue,
-				                 parse_state );
-				return result;
-			} else {
-				return json_details::parse_value_array<parser_t, KnownBounds>(
-				  parse_state );
-			}
+			return json_details::with_document_context<ParseState>(
+			  std::data( json_data ), [&]( ) {
+				if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
+					auto result =
+					  json_details::parse_value_array<parser_t, KnownBounds>(
+					    parse_state );
+					parse_state.trim_left( );
+					daw_json_ensure( parse_state.empty( ),
+					                 ErrorReason::InvalidEndOfValue, parse_state );
+					return result;
+				} else {
+					return json_details::parse_value_array<parser_t, KnownBounds>(
+					  parse_state );
+				}
+			  } );
 		}
 
 		/// @brief Parse JSON data where the root item is an array
@@ -0,0 +1,319 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_from_json.h"
+#include "daw_json_link_types.h"
+
+#include <daw/daw_move.h>
+#include <daw/daw_traits.h>
+
+#include <ciso646>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief A column of strings stored as a single contiguous character
+		/// buffer and the offset of each value within it.  Value i is
+		/// chars( )[offsets( )[i], offsets( )[i + 1])
+		class json_string_column {
+			std::vector<char> m_chars{ };
+			std::vector<std::size_t> m_offsets = std::vector<std::size_t>( 1, 0 );
+
+		public:
+			using value_type = std::string_view;
+			using size_type = std::size_t;
+
+			json_string_column( ) = default;
+
+			[[nodiscard]] size_type size( ) const noexcept {
+				return m_offsets.size( ) - 1U;
+			}
+
+			[[nodiscard]] bool empty( ) const noexcept {
+				return m_offsets.size( ) == 1U;
+			}
+
+			[[nodiscard]] std::string_view operator[]( size_type idx ) const {
+				return std::string_view( m_chars.data( ) + m_offsets[idx],
+				                         m_offsets[idx + 1] - m_offsets[idx] );
+			}
+
+			/// @brief All the characters of the column, without separators
+			[[nodiscard]] std::string_view chars( ) const noexcept {
+				return std::string_view( m_chars.data( ), m_chars.size( ) );
+			}
+
+			/// @brief size( ) + 1 offsets into chars( ).  The first is always 0
+			[[nodiscard]] std::vector<std::size_t> const &offsets( ) const noexcept {
+				return m_offsets;
+			}
+
+			void reserve( size_type count ) {
+				m_offsets.reserve( count + 1U );
+			}
+
+			void push_back( std::string_view value ) {
+				m_chars.insert( m_chars.end( ), value.begin( ), value.end( ) );
+				m_offsets.push_back( m_chars.size( ) );
+			}
+		};
+
+		namespace json_details {
+			/// @brief Strings are stored as offset+bytes, everything else is a
+			/// std::vector of the member's parse_to_t
+			template<typename T>
+			using json_column_t =
+			  std::conditional_t<std::is_same_v<T, std::string>, json_string_column,
+			                     std::vector<T>>;
+
+			template<typename MemberList>
+			struct column_member_types {
+				static_assert( daw::deduced_false_v<MemberList>,
+				               "from_json_columns requires a json_data_contract "
+				               "that is a json_member_list" );
+			};
+
+			template<typename... JsonMembers>
+			struct column_member_types<json_member_list<JsonMembers...>> {
+				using values_t = std::tuple<json_result<JsonMembers>...>;
+				using columns_t = std::tuple<json_column_t<json_result<JsonMembers>>...>;
+			};
+
+			template<typename Row>
+			using column_member_types_t =
+			  column_member_types<json_data_contract_trait_t<Row>>;
+
+			/// @brief The parsed members of a single Row.  It is parsed with the
+			/// json_member_list of Row but the Row itself is never constructed
+			template<typename Row>
+			struct column_row {
+				using values_t = typename column_member_types_t<Row>::values_t;
+				values_t values;
+
+				template<typename... Args,
+				         std::enable_if_t<( sizeof...( Args ) ==
+				                              std::tuple_size_v<values_t> and
+				                            std::is_constructible_v<values_t, Args...> ),
+				                          std::nullptr_t> = nullptr>
+				explicit constexpr column_row( Args &&...args )
+				  : values( DAW_FWD( args )... ) {}
+			};
+		} // namespace json_details
+
+		/// @brief column_row is parsed with the mapping of Row
+		template<typename Row>
+		struct json_data_contract<json_details::column_row<Row>> {
+			using type = json_data_contract_trait_t<Row>;
+		};
+
+		template<typename Row>
+		struct ignore_unknown_members<json_details::column_row<Row>>
+		  : std::bool_constant<ignore_unknown_members_v<Row>> {};
+
+		template<typename Row>
+		inline constexpr bool
+		  is_exact_class_mapping_v<json_details::column_row<Row>> =
+		    is_exact_class_mapping_v<Row>;
+
+		/***
+		 * @brief The result of from_json_columns.  Each mapped member of Row is
+		 * stored in its own contiguous column, in the order of the Row's
+		 * json_member_list
+		 * @tparam Row A type with a json_data_contract that is a json_member_list
+		 */
+		template<typename Row>
+		class json_columns {
+		public:
+			using columns_t =
+			  typename json_details::column_member_types_t<Row>::columns_t;
+			using size_type = std::size_t;
+			static constexpr size_type column_count = std::tuple_size_v<columns_t>;
+
+		private:
+			columns_t m_columns{ };
+			size_type m_size = 0;
+
+			template<typename ColumnRow, std::size_t... Is>
+			void append_row_impl( ColumnRow &&row, std::index_sequence<Is...> ) {
+				( std::get<Is>( m_columns )
+				    .push_back( std::get<Is>( DAW_FWD( row ).values ) ),
+				  ... );
+			}
+
+			template<std::size_t... Is>
+			void reserve_impl( size_type count, std::index_sequence<Is...> ) {
+				( std::get<Is>( m_columns ).reserve( count ), ... );
+			}
+
+		public:
+			json_columns( ) = default;
+
+			/// @brief The number of rows
+			[[nodiscard]] size_type size( ) const noexcept {
+				return m_size;
+			}
+
+			[[nodiscard]] bool empty( ) const noexcept {
+				return m_size == 0;
+			}
+
+			/// @brief The column for the Idx'th member of Row's json_member_list
+			template<std::size_t Idx>
+			[[nodiscard]] std::tuple_element_t<Idx, columns_t> const &
+			column( ) const & {
+				return std::get<Idx>( m_columns );
+			}
+
+			template<std::size_t Idx>
+			[[nodiscard]] std::tuple_element_t<Idx, columns_t> &column( ) & {
+				return std::get<Idx>( m_columns );
+			}
+
+			template<std::size_t Idx>
+			[[nodiscard]] std::tuple_element_t<Idx, columns_t> column( ) && {
+				return std::get<Idx>( DAW_MOVE( m_columns ) );
+			}
+
+			[[nodiscard]] columns_t const &columns( ) const & {
+				return m_columns;
+			}
+
+			[[nodiscard]] columns_t columns( ) && {
+				return DAW_MOVE( m_columns );
+			}
+
+			void reserve( size_type count ) {
+				reserve_impl( count, std::make_index_sequence<column_count>{ } );
+			}
+
+			template<typename ColumnRow>
+			void append_row( ColumnRow &&row ) {
+				static_assert(
+				  std::is_same_v<daw::remove_cvref_t<ColumnRow>,
+				                 json_details::column_row<Row>>,
+				  "Unexpected row type" );
+				append_row_impl( DAW_FWD( row ),
+				                 std::make_index_sequence<column_count>{ } );
+				++m_size;
+			}
+		};
+
+		/// @brief Constructor used by from_json_columns to append each parsed row
+		/// to the columns
+		template<typename Row>
+		struct json_columns_constructor {
+			[[nodiscard]] DAW_JSON_CPP23_STATIC_CALL_OP json_columns<Row>
+			operator( )( ) DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+				return json_columns<Row>{ };
+			}
+
+			template<typename Iterator>
+			[[nodiscard]] DAW_JSON_CPP23_STATIC_CALL_OP json_columns<Row>
+			operator( )( Iterator first,
+			             Iterator last ) DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+				auto result = json_columns<Row>{ };
+				if constexpr( std::is_same_v<std::random_access_iterator_tag,
+				                             typename std::iterator_traits<
+				                               Iterator>::iterator_category> ) {
+					result.reserve(
+					  static_cast<std::size_t>( std::distance( first, last ) ) );
+				}
+				while( first != last ) {
+					result.append_row( *first );
+					++first;
+				}
+				return result;
+			}
+		};
+
+		/// @brief Parse a JSON array of objects directly into columns.  Each
+		/// member mapped in Row's json_data_contract is appended to its own
+		/// column and no Row is ever constructed
+		/// @tparam Row Type with a json_data_contract that is a json_member_list
+		/// @param json_data JSON string data containing an array of Row
+		/// @tparam KnownBounds The bounds of the json_data are known to contain
+		/// the whole value
+		/// @return The columns of the parsed rows
+		/// @throws daw::json::json_exception
+		template<typename Row, bool KnownBounds = false, typename String,
+		         auto... PolicyFlags>
+		[[nodiscard]] json_columns<Row>
+		from_json_columns( String &&json_data,
+		                   options::parse_flags_t<PolicyFlags...> flags ) {
+			return from_json_array<json_class_no_name<json_details::column_row<Row>>,
+			                       json_columns<Row>, json_columns_constructor<Row>,
+			                       KnownBounds>( DAW_FWD( json_data ), flags );
+		}
+
+		/// @brief Parse a JSON array of objects directly into columns.  Each
+		/// member mapped in Row's json_data_contract is appended to its own
+		/// column and no Row is ever constructed
+		/// @tparam Row Type with a json_data_contract that is a json_member_list
+		/// @param json_data JSON string data containing an array of Row
+		/// @tparam KnownBounds The bounds of the json_data are known to contain
+		/// the whole value
+		/// @return The columns of the parsed rows
+		/// @throws daw::json::json_exception
+		template<typename Row, bool KnownBounds = false, typename String>
+		[[nodiscard]] json_columns<Row> from_json_columns( String &&json_data ) {
+			return from_json_columns<Row, KnownBounds>( DAW_FWD( json_data ),
+			                                            options::parse_flags<> );
+		}
+
+		/// @brief Parse a JSON array of objects, found at member_path, directly
+		/// into columns
+		/// @tparam Row Type with a json_data_contract that is a json_member_list
+		/// @param json_data JSON string data
+		/// @param member_path A dot separated path of member names to start
+		/// parsing from. Array indices are specified with square brackets e.g. [5]
+		/// is the 6th item
+		/// @tparam KnownBounds The bounds of the json_data are known to contain
+		/// the whole value
+		/// @return The columns of the parsed rows
+		/// @throws daw::json::json_exception
+		template<typename Row, bool KnownBounds = false, typename String,
+		         auto... PolicyFlags>
+		[[nodiscard]] json_columns<Row>
+		from_json_columns( String &&json_data, std::string_view member_path,
+		                   options::parse_flags_t<PolicyFlags...> flags ) {
+			return from_json_array<json_class_no_name<json_details::column_row<Row>>,
+			                       json_columns<Row>, json_columns_constructor<Row>,
+			                       KnownBounds>( DAW_FWD( json_data ), member_path,
+			                                     flags );
+		}
+
+		/// @brief Parse a JSON array of objects, found at member_path, directly
+		/// into columns
+		/// @tparam Row Type with a json_data_contract that is a json_member_list
+		/// @param json_data JSON string data
+		/// @param member_path A dot separated path of member names to start
+		/// parsing from. Array indices are specified with square brackets e.g. [5]
+		/// is the 6th item
+		/// @tparam KnownBounds The bounds of the json_data are known to contain
+		/// the whole value
+		/// @return The columns of the parsed rows
+		/// @throws daw::json::json_exception
+		template<typename Row, bool KnownBounds = false, typename String>
+		[[nodiscard]] json_columns<Row>
+		from_json_columns( String &&json_data, std::string_view member_path ) {
+			return from_json_columns<Row, KnownBounds>(
+			  DAW_FWD( json_data ), member_path, options::parse_flags<> );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,449 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_from_json.h"
+#include "daw_json_link_types.h"
+
+#include <daw/daw_move.h>
+#include <daw/daw_traits.h>
+
+#include <algorithm>
+#include <array>
+#include <ciso646>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			template<typename T>
+			using to_json_data_result_t =
+			  decltype( json_data_contract<T>::to_json_data(
+			    std::declval<T const &>( ) ) );
+
+			template<typename JsonMembers, typename Slots>
+			struct into_class_members_impl;
+
+			template<typename... JsonMembers, typename... Slots>
+			struct into_class_members_impl<std::tuple<JsonMembers...>,
+			                               std::tuple<Slots...>>
+			  : std::bool_constant<(
+			      ( std::is_lvalue_reference_v<Slots> and
+			        std::is_same_v<daw::remove_cvref_t<Slots>,
+			                       json_result<JsonMembers>> ) and
+			      ... )> {};
+
+			template<typename MemberList, typename Slots>
+			struct into_class_members : std::false_type {};
+
+			/// @brief Every member of the mapping must be a reference to a member of
+			/// exactly the type that would be parsed
+			template<typename... JsonMembers, typename... Slots>
+			struct into_class_members<json_member_list<JsonMembers...>,
+			                          std::tuple<Slots...>>
+			  : std::conditional_t<
+			      sizeof...( JsonMembers ) == sizeof...( Slots ),
+			      into_class_members_impl<std::tuple<JsonMembers...>,
+			                              std::tuple<Slots...>>,
+			      std::false_type> {};
+
+			template<typename T, typename = void>
+			inline constexpr bool is_into_class_v = false;
+
+			/***
+			 * @brief T can be parsed into when its json_data_contract is a
+			 * json_member_list and to_json_data returns references to the mapped
+			 * members.  T must be an aggregate without a data contract constructor,
+			 * as assigning the members bypasses any constructor that validates or
+			 * normalizes them.  The references returned by to_json_data are written
+			 * to through a const_cast, so they must refer to the non-const members
+			 * of the value passed in and never to other objects, e.g. statics
+			 */
+			template<typename T>
+			inline constexpr bool is_into_class_v<
+			  T, std::enable_if_t<has_json_data_contract_trait_v<T>>> =
+			  std::is_aggregate_v<T> and not has_data_contract_constructor_v<T> and
+			  not daw::is_detected_v<json_class_constructor_t_impl, T> and
+			  into_class_members<
+			    json_data_contract_trait_t<T>,
+			    daw::detected_t<to_json_data_result_t, T>>::value;
+
+			template<typename T>
+			inline constexpr bool is_into_string_v = false;
+
+			template<typename Traits, typename Alloc>
+			inline constexpr bool
+			  is_into_string_v<std::basic_string<char, Traits, Alloc>> = true;
+
+			template<typename T>
+			inline constexpr bool is_into_vector_v = false;
+
+			/// @brief vector<bool> does not have addressable elements
+			template<typename T, typename Alloc>
+			inline constexpr bool is_into_vector_v<std::vector<T, Alloc>> =
+			  not std::is_same_v<T, bool>;
+
+			template<typename T>
+			inline constexpr bool is_into_optional_v = false;
+
+			template<typename T>
+			inline constexpr bool is_into_optional_v<std::optional<T>> = true;
+
+			template<typename T, typename Key>
+			using map_find_t =
+			  decltype( std::declval<T &>( ).find( std::declval<Key const &>( ) ) );
+
+			/// @brief The address of an element does not change when other elements
+			/// are inserted
+			template<typename T>
+			inline constexpr bool has_stable_map_nodes_v = false;
+
+			template<typename Key, typename Value, typename Compare, typename Alloc>
+			inline constexpr bool
+			  has_stable_map_nodes_v<std::map<Key, Value, Compare, Alloc>> = true;
+
+			template<typename Key, typename Value, typename Hash, typename KeyEqual,
+			         typename Alloc>
+			inline constexpr bool has_stable_map_nodes_v<
+			  std::unordered_map<Key, Value, Hash, KeyEqual, Alloc>> = true;
+
+			template<typename JsonMember, typename T, typename = void>
+			inline constexpr bool is_into_map_v = false;
+
+			template<typename JsonMember, typename T>
+			inline constexpr bool is_into_map_v<
+			  JsonMember, T,
+			  std::void_t<typename T::key_type, typename T::mapped_type,
+			              map_find_t<T, typename T::key_type>>> =
+			  has_stable_map_nodes_v<T> and
+			  std::is_same_v<typename T::key_type,
+			                 json_result<typename JsonMember::json_key_t>> and
+			  std::is_same_v<typename T::mapped_type,
+			                 json_result<typename JsonMember::json_element_t>>;
+
+			/// @brief The value is constructed the same way parse_value would
+			/// construct it, so assigning into the existing value is equivalent
+			template<typename JsonMember>
+			inline constexpr bool has_default_into_constructor_v =
+			  std::is_same_v<typename JsonMember::constructor_t,
+			                 default_constructor<json_result<JsonMember>>>;
+
+			/// @brief The slots refer to members of the value being parsed into, see
+			/// is_into_class_v
+			template<typename T>
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr T &
+			into_slot( T const &value ) noexcept {
+				return const_cast<T &>( value );
+			}
+
+			template<typename T, typename ParseState>
+			void parse_class_into( ParseState &parse_state, T &value );
+
+			/// @brief Parse the next value in parse_state into value.  Strings,
+			/// vectors, maps, optionals, and classes reuse the storage they already
+			/// own, everything else is assigned the result of parse_value
+			template<typename JsonMember, typename ParseState, typename T>
+			void parse_value_into( ParseState &parse_state, T &value ) {
+				static_assert( std::is_same_v<T, json_result<JsonMember>> );
+				constexpr JsonParseTypes expected_type = JsonMember::expected_type;
+
+				if constexpr( expected_type == JsonParseTypes::Null and
+				              is_into_optional_v<T> and
+				              std::is_same_v<typename JsonMember::constructor_t,
+				                             nullable_constructor<T>> and
+				              std::is_same_v<
+				                typename T::value_type,
+				                json_result<typename JsonMember::member_type>> ) {
+					parse_state.trim_left( );
+					if( value.has_value( ) and parse_state.has_more( ) and
+					    parse_state.front( ) != 'n' ) {
+						parse_value_into<typename JsonMember::member_type>( parse_state,
+						                                                    *value );
+					} else {
+						value = parse_value<JsonMember>(
+						  parse_state, ParseTag<JsonParseTypes::Null>{ } );
+					}
+				} else if constexpr( ( expected_type == JsonParseTypes::StringRaw or
+				                       expected_type ==
+				                         JsonParseTypes::StringEscaped ) and
+				                     is_into_string_v<T> and
+				                     has_default_into_constructor_v<JsonMember> ) {
+					auto str = skip_string( parse_state );
+					if constexpr( expected_type == JsonParseTypes::StringEscaped ) {
+						constexpr bool allow_high_eight_bits =
+						  JsonMember::eight_bit_mode !=
+						  options::EightBitModes::DisallowHigh;
+						if( not allow_high_eight_bits or needs_slow_path( str ) ) {
+							// There are escapes in the string
+							value = parse_string_known_stdstring<allow_high_eight_bits,
+							                                     JsonMember, true>( str );
+							return;
+						}
+					}
+					// assign keeps the current capacity when it is large enough
+					value.assign( std::data( str ), std::size( str ) );
+				} else if constexpr( expected_type == JsonParseTypes::Array and
+				                     is_into_vector_v<T> and
+				                     has_default_into_constructor_v<JsonMember> ) {
+					using element_t = typename JsonMember::json_element_t;
+					parse_state.trim_left( );
+					daw_json_assert_weak( parse_state.is_opening_bracket_checked( ),
+					                      ErrorReason::InvalidArrayStart, parse_state );
+					parse_state.remove_prefix( );
+					parse_state.trim_left_unchecked( );
+
+					std::size_t count = 0;
+					daw_json_assert_weak( parse_state.has_more( ),
+					                      ErrorReason::UnexpectedEndOfData, parse_state );
+					while( parse_state.front( ) != ']' ) {
+						if( count < value.size( ) ) {
+							parse_value_into<element_t>( parse_state, value[count] );
+						} else {
+							value.push_back( parse_value<element_t>(
+							  parse_state, ParseTag<element_t::expected_type>{ } ) );
+						}
+						++count;
+						parse_state.trim_left( );
+						daw_json_assert_weak( parse_state.has_more( ) and
+						                        parse_state.is_at_next_array_element( ),
+						                      ErrorReason::UnexpectedEndOfData,
+						                      parse_state );
+						parse_state.move_next_member_or_end( );
+						daw_json_assert_weak( parse_state.has_more( ),
+						                      ErrorReason::UnexpectedEndOfData,
+						                      parse_state );
+					}
+					parse_state.remove_prefix( );
+					parse_state.trim_left_checked( );
+					value.erase( std::next( value.begin( ),
+					                        static_cast<std::ptrdiff_t>( count ) ),
+					             value.end( ) );
+				} else if constexpr( expected_type == JsonParseTypes::KeyValue and
+				                     is_into_map_v<JsonMember, T> and
+				                     has_default_into_constructor_v<JsonMember> ) {
+					using key_t = typename JsonMember::json_key_t;
+					using element_t = typename JsonMember::json_element_t;
+					parse_state.trim_left( );
+					auto const original_state = parse_state;
+					daw_json_assert_weak( parse_state.is_opening_brace_checked( ),
+					                      ErrorReason::ExpectedKeyValueToStartWithBrace,
+					                      parse_state );
+					parse_state.remove_prefix( );
+					parse_state.trim_left( );
+
+					// The element of each member of the document.  The result is only
+					// the same as parse_value's when every element of value was in the
+					// document exactly once
+					using mapped_t = typename T::mapped_type;
+					auto visited = std::vector<mapped_t const *>( );
+					visited.reserve( value.size( ) );
+					daw_json_assert_weak( parse_state.has_more( ),
+					                      ErrorReason::UnexpectedEndOfData, parse_state );
+					while( parse_state.front( ) != '}' ) {
+						auto key = parse_value<key_t>( parse_state,
+						                               ParseTag<key_t::expected_type>{ } );
+						name::name_parser::trim_end_of_name( parse_state );
+						if( auto pos = value.find( key ); pos != value.end( ) ) {
+							parse_value_into<element_t>( parse_state, pos->second );
+							visited.push_back( std::addressof( pos->second ) );
+						} else {
+							auto const ins = value.emplace(
+							  DAW_MOVE( key ),
+							  parse_value<element_t>(
+							    parse_state, ParseTag<element_t::expected_type>{ } ) );
+							visited.push_back( std::addressof( ins.first->second ) );
+						}
+						parse_state.move_next_member_or_end( );
+						daw_json_assert_weak( parse_state.has_more( ),
+						                      ErrorReason::UnexpectedEndOfData,
+						                      parse_state );
+					}
+					parse_state.remove_prefix( );
+					parse_state.trim_left_checked( );
+					std::sort( visited.begin( ), visited.end( ), std::less<>{ } );
+					if( visited.size( ) != value.size( ) or
+					    std::adjacent_find( visited.begin( ), visited.end( ) ) !=
+					      visited.end( ) ) {
+						// Keys that are no longer in the document, or duplicate keys.
+						// Rebuild the map so the result is the same as parse_value's
+						auto state = original_state;
+						value = parse_value<JsonMember>(
+						  state, ParseTag<JsonParseTypes::KeyValue>{ } );
+					}
+				} else if constexpr( expected_type == JsonParseTypes::Class and
+				                     is_into_class_v<T> and
+				                     has_default_into_constructor_v<JsonMember> ) {
+					parse_class_into( parse_state, value );
+				} else {
+					value =
+					  parse_value<JsonMember>( parse_state, ParseTag<expected_type>{ } );
+				}
+			}
+
+			template<typename... JsonMembers, typename ParseState, typename Slots,
+			         std::size_t... Is>
+			void parse_members_into( ParseState &parse_state, Slots const &slots,
+			                         bool exact_mapping,
+			                         std::index_sequence<Is...> ) {
+				constexpr std::size_t member_count = sizeof...( JsonMembers );
+				std::array<bool, member_count> found{ };
+
+				daw_json_assert_weak( parse_state.has_more( ),
+				                      ErrorReason::UnexpectedEndOfData, parse_state );
+				while( parse_state.front( ) != '}' ) {
+					daw_json_assert_weak( parse_state.is_at_next_class_member( ),
+					                      ErrorReason::MissingMemberNameOrEndOfClass,
+					                      parse_state );
+					auto const name = parse_name( parse_state );
+					std::size_t idx = member_count;
+					(void)( ( JsonMembers::name == name ? ( idx = Is, true ) : false ) or
+					        ... );
+					if( idx == member_count ) {
+						daw_json_ensure( not exact_mapping, ErrorReason::UnknownMember,
+						                 parse_state );
+						(void)skip_value( parse_state );
+					} else {
+						auto const class_pos = parse_state.get_class_position( );
+						(void)( ( Is == idx
+						            ? ( parse_value_into<without_name<JsonMembers>>(
+						                  parse_state, into_slot( std::get<Is>( slots ) ) ),
+						                true )
+						            : false ) or
+						        ... );
+						parse_state.set_class_position( class_pos );
+						found[idx] = true;
+					}
+					parse_state.move_next_member_or_end( );
+					daw_json_assert_weak( parse_state.has_more( ),
+					                      ErrorReason::UnexpectedEndOfData, parse_state );
+				}
+
+				auto const reset_missing = [&]( auto member, auto &slot,
+				                                bool is_found ) {
+					using json_member = typename decltype( member )::type;
+					if( is_found ) {
+						return;
+					}
+					if constexpr( is_json_nullable_v<json_member> ) {
+						slot =
+						  construct_nullable_empty<typename json_member::constructor_t>( );
+					} else {
+						daw_json_error( missing_member( std::string_view(
+						                  std::data( json_member::name ),
+						                  std::size( json_member::name ) ) ),
+						                parse_state );
+					}
+				};
+				( reset_missing( daw::traits::identity<JsonMembers>{ },
+				                 into_slot( std::get<Is>( slots ) ), found[Is] ),
+				  ... );
+			}
+
+			template<typename... JsonMembers, typename T, typename ParseState>
+			void parse_member_list_into( json_member_list<JsonMembers...>,
+			                             ParseState &parse_state, T &value ) {
+				parse_members_into<JsonMembers...>(
+				  parse_state, json_data_contract<T>::to_json_data( value ),
+				  all_json_members_must_exist_v<T, ParseState>,
+				  std::index_sequence_for<JsonMembers...>{ } );
+			}
+
+			/// @brief Parse the JSON object in parse_state into the members of value
+			/// that are referenced by its json_data_contract's to_json_data
+			template<typename T, typename ParseState>
+			void parse_class_into( ParseState &parse_state, T &value ) {
+				static_assert( is_into_class_v<T> );
+				parse_state.trim_left( );
+				daw_json_assert_weak( parse_state.is_opening_brace_checked( ),
+				                      ErrorReason::InvalidClassStart, parse_state );
+
+				auto const old_class_pos = parse_state.get_class_position( );
+				parse_state.set_class_position( );
+				parse_state.remove_prefix( );
+				parse_state.trim_left( );
+
+				parse_member_list_into( json_data_contract_trait_t<T>{ }, parse_state,
+				                        value );
+
+				parse_state.remove_prefix( );
+				parse_state.trim_left_checked( );
+				parse_state.set_class_position( old_class_pos );
+			}
+		} // namespace json_details
+
+		/// @brief Parse JSON data into an existing value, reusing the storage it
+		/// already owns.  Strings are assigned in place, vectors keep their
+		/// elements and capacity, std::map and std::unordered_map keep the nodes
+		/// of keys that are still present, and nested classes are parsed into
+		/// recursively.  This needs T to be an aggregate without a data contract
+		/// constructor, its json_data_contract to be a json_member_list and its
+		/// to_json_data to return references to T's(non-const) data members.
+		/// Otherwise the result of from_json<T> is assigned to existing.
+		/// @param existing value to parse into.  If an error occurs it is left in a
+		/// valid but unspecified state
+		/// @param json_data JSON string data containing a T
+		/// @throws daw::json::json_exception
+		template<typename T, typename String, auto... PolicyFlags>
+		void from_json_into( T &existing, String &&json_data,
+		                     options::parse_flags_t<PolicyFlags...> flags ) {
+			static_assert(
+			  json_details::is_string_view_like_v<String>,
+			  "String type must have a be a contiguous range of Characters" );
+			if constexpr( json_details::is_into_class_v<T> ) {
+				(void)flags;
+				daw_json_ensure( std::data( json_data ) != nullptr,
+				                 ErrorReason::EmptyJSONDocument );
+				daw_json_ensure( std::size( json_data ) != 0,
+				                 ErrorReason::EmptyJSONDocument );
+
+				using ParsePolicy =
+				  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+				using policy_zstring_t = json_details::apply_zstring_policy_option_t<
+				  ParsePolicy, String, options::ZeroTerminatedString::yes>;
+				using ParseState =
+				  std::conditional_t<policy_zstring_t::is_default_parse_policy,
+				                     DefaultParsePolicy, policy_zstring_t>;
+				auto parse_state =
+				  ParseState( std::data( json_data ), daw::data_end( json_data ) );
+
+				json_details::parse_class_into( parse_state, existing );
+				if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
+					parse_state.trim_left( );
+					daw_json_ensure( parse_state.empty( ), ErrorReason::InvalidEndOfValue,
+					                 parse_state );
+				}
+			} else {
+				existing = from_json<T>( DAW_FWD( json_data ), flags );
+			}
+		}
+
+		/// @brief Parse JSON data into an existing value, reusing the storage it
+		/// already owns.  See from_json_into( T &, String &&, parse_flags_t )
+		/// @param existing value to parse into.  If an error occurs it is left in a
+		/// valid but unspecified state
+		/// @param json_data JSON string data containing a T
+		/// @throws daw::json::json_exception
+		template<typename T, typename String>
+		void from_json_into( T &existing, String &&json_data ) {
+			from_json_into( existing, DAW_FWD( json_data ), options::parse_flags<> );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,358 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_lazy_number.h"
+#include "daw_json_link_types.h"
+#include "impl/daw_json_parse_digit.h"
+#include "impl/daw_json_parse_unsigned_int.h"
+#include "impl/to_daw_json_string.h"
+
+#include <daw/daw_arith_traits.h>
+#include <daw/daw_attributes.h>
+
+#include <algorithm>
+#include <ciso646>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief Accumulate the digits in [first, last) onto result, 8 at a
+			/// time with the SWAR digit parser
+			template<typename Unsigned>
+			[[nodiscard]] constexpr Unsigned
+			decimal_accumulate_digits( Unsigned result, char const *first,
+			                           char const *const last ) {
+				while( last - first >= 8 ) {
+					result *= static_cast<Unsigned>( 100'000'000ULL );
+					result += static_cast<Unsigned>( parse_8_digits( first ) );
+					first += 8;
+				}
+				while( first < last ) {
+					result *= static_cast<Unsigned>( 10U );
+					result += static_cast<Unsigned>( parse_digit( *first ) );
+					++first;
+				}
+				return result;
+			}
+
+			[[nodiscard]] constexpr std::size_t
+			decimal_leading_zeros( std::string_view digits ) {
+				std::size_t result = 0;
+				while( result < digits.size( ) and digits[result] == '0' ) {
+					++result;
+				}
+				return result;
+			}
+
+			[[nodiscard]] constexpr bool
+			decimal_all_zeros( std::string_view digits ) {
+				return decimal_leading_zeros( digits ) == digits.size( );
+			}
+
+			template<typename Integer>
+			[[nodiscard]] constexpr Integer decimal_pow10( std::size_t exponent ) {
+				auto result = static_cast<Integer>( 1 );
+				while( exponent-- > 0 ) {
+					result *= static_cast<Integer>( 10 );
+				}
+				return result;
+			}
+
+			/// @brief Parse a JSON number to its value times 10^Scale, without a
+			/// floating point intermediary
+			/// @throws daw::json::json_exception when str is not a JSON number, or
+			/// when the value has non-zero digits past Scale or does not fit in
+			/// Integer
+			template<typename Integer, std::size_t Scale>
+			[[nodiscard]] constexpr Integer
+			parse_decimal_unscaled( std::string_view str ) {
+				using unsigned_t = typename daw::make_unsigned<Integer>::type;
+				auto const parts = split_lazy_number( str );
+				if( decimal_all_zeros( parts.whole ) and
+				    decimal_all_zeros( parts.fraction ) ) {
+					return Integer{ };
+				}
+
+				std::ptrdiff_t exponent = 0;
+				if( not parts.exponent.empty( ) ) {
+					auto exp_digits = parts.exponent;
+					bool const exp_negative = exp_digits.front( ) == '-';
+					if( exp_negative or exp_digits.front( ) == '+' ) {
+						exp_digits.remove_prefix( 1 );
+					}
+					exp_digits.remove_prefix(
+					  ( std::min )( decimal_leading_zeros( exp_digits ),
+					                exp_digits.size( ) - 1U ) );
+					// A non-zero value cannot be exact with an exponent this large
+					daw_json_ensure( exp_digits.size( ) <= 4U,
+					                 ErrorReason::NumberOutOfRange );
+					for( char c : exp_digits ) {
+						exponent *= 10;
+						exponent += static_cast<std::ptrdiff_t>( parse_digit( c ) );
+					}
+					if( exp_negative ) {
+						exponent = -exponent;
+					}
+				}
+
+				// The digits of whole followed by fraction that are left of the
+				// decimal point once the value is scaled
+				auto const whole_size =
+				  static_cast<std::ptrdiff_t>( parts.whole.size( ) );
+				auto const fraction_size =
+				  static_cast<std::ptrdiff_t>( parts.fraction.size( ) );
+				auto const kept =
+				  whole_size + exponent + static_cast<std::ptrdiff_t>( Scale );
+				auto const whole_kept = static_cast<std::size_t>(
+				  ( std::max )( std::ptrdiff_t{ 0 },
+				                ( std::min )( kept, whole_size ) ) );
+				auto const fraction_kept = static_cast<std::size_t>(
+				  ( std::max )( std::ptrdiff_t{ 0 },
+				                ( std::min )( kept - whole_size, fraction_size ) ) );
+				auto const zero_pad = static_cast<std::size_t>( ( std::max )(
+				  std::ptrdiff_t{ 0 }, kept - ( whole_size + fraction_size ) ) );
+
+				daw_json_ensure(
+				  decimal_all_zeros( parts.whole.substr( whole_kept ) ) and
+				    decimal_all_zeros( parts.fraction.substr( fraction_kept ) ),
+				  ErrorReason::NumberOutOfRange );
+
+				auto leading =
+				  decimal_leading_zeros( parts.whole.substr( 0, whole_kept ) );
+				if( leading == whole_kept ) {
+					leading += decimal_leading_zeros(
+					  parts.fraction.substr( 0, fraction_kept ) );
+				}
+				auto const significant_digits =
+				  whole_kept + fraction_kept + zero_pad - leading;
+				daw_json_ensure(
+				  significant_digits <= static_cast<std::size_t>(
+				                          daw::numeric_limits<unsigned_t>::digits10 ),
+				  ErrorReason::NumberOutOfRange );
+
+				auto result = decimal_accumulate_digits(
+				  unsigned_t{ }, parts.whole.data( ), parts.whole.data( ) + whole_kept );
+				result = decimal_accumulate_digits( result, parts.fraction.data( ),
+				                                    parts.fraction.data( ) +
+				                                      fraction_kept );
+				result *= decimal_pow10<unsigned_t>( zero_pad );
+
+				constexpr auto max_value =
+				  static_cast<unsigned_t>( ( daw::numeric_limits<Integer>::max )( ) );
+				if( parts.is_negative ) {
+					daw_json_ensure( result <= max_value + 1U,
+					                 ErrorReason::NumberOutOfRange );
+					if( result == max_value + 1U ) {
+						return ( daw::numeric_limits<Integer>::min )( );
+					}
+					return static_cast<Integer>( -static_cast<Integer>( result ) );
+				}
+				daw_json_ensure( result <= max_value, ErrorReason::NumberOutOfRange );
+				return static_cast<Integer>( result );
+			}
+		} // namespace json_details
+
+		/***
+		 * @brief An exact fixed point decimal.  The value is stored as an integer
+		 * count of 10^-Scale units, e.g. a basic_json_decimal<2> holding 12.34
+		 * stores 1234.  It is parsed directly from the digits of a JSON number and
+		 * serialized with exactly Scale fractional digits, so no floating point
+		 * rounding is involved either way.
+		 * @tparam Scale Number of digits after the decimal point
+		 * @tparam Integer signed integer type holding the unscaled value.  A 128bit
+		 * integer can be used where the platform supports one
+		 */
+		template<std::size_t Scale, typename Integer = std::int64_t>
+		class basic_json_decimal {
+			static_assert( daw::is_integral_v<Integer> and daw::is_signed_v<Integer>,
+			               "Integer must be a signed integer type" );
+			static_assert(
+			  Scale <=
+			    static_cast<std::size_t>( daw::numeric_limits<Integer>::digits10 ),
+			  "10^Scale must be representable by Integer" );
+
+			Integer m_unscaled = Integer{ };
+
+		public:
+			using integer_type = Integer;
+			static constexpr std::size_t scale = Scale;
+			static constexpr Integer scale_factor =
+			  json_details::decimal_pow10<Integer>( Scale );
+
+			constexpr basic_json_decimal( ) = default;
+
+			/// @brief Parse a JSON number
+			/// @throws daw::json::json_exception when digits is not a JSON number or
+			/// cannot be represented exactly
+			explicit constexpr basic_json_decimal( std::string_view digits )
+			  : m_unscaled(
+			      json_details::parse_decimal_unscaled<Integer, Scale>( digits ) ) {}
+
+			[[nodiscard]] static constexpr basic_json_decimal
+			from_unscaled( Integer unscaled ) {
+				auto result = basic_json_decimal( );
+				result.m_unscaled = unscaled;
+				return result;
+			}
+
+			/// @brief The value times 10^Scale
+			[[nodiscard]] constexpr Integer unscaled( ) const {
+				return m_unscaled;
+			}
+
+			/// @brief The digits before the decimal point, with the value's sign
+			[[nodiscard]] constexpr Integer integral_part( ) const {
+				return static_cast<Integer>( m_unscaled / scale_factor );
+			}
+
+			/// @brief The digits after the decimal point, with the value's sign
+			[[nodiscard]] constexpr Integer fractional_part( ) const {
+				return static_cast<Integer>( m_unscaled % scale_factor );
+			}
+
+			[[nodiscard]] constexpr bool
+			operator==( basic_json_decimal const &rhs ) const {
+				return m_unscaled == rhs.m_unscaled;
+			}
+
+			[[nodiscard]] constexpr bool
+			operator!=( basic_json_decimal const &rhs ) const {
+				return m_unscaled != rhs.m_unscaled;
+			}
+
+			[[nodiscard]] constexpr bool
+			operator<( basic_json_decimal const &rhs ) const {
+				return m_unscaled < rhs.m_unscaled;
+			}
+
+			[[nodiscard]] constexpr bool
+			operator<=( basic_json_decimal const &rhs ) const {
+				return m_unscaled <= rhs.m_unscaled;
+			}
+
+			[[nodiscard]] constexpr bool
+			operator>( basic_json_decimal const &rhs ) const {
+				return m_unscaled > rhs.m_unscaled;
+			}
+
+			[[nodiscard]] constexpr bool
+			operator>=( basic_json_decimal const &rhs ) const {
+				return m_unscaled >= rhs.m_unscaled;
+			}
+		};
+
+		template<std::size_t Scale>
+		using json_decimal = basic_json_decimal<Scale>;
+
+		namespace json_details {
+			template<typename Decimal>
+			struct decimal_from_json_converter {
+				[[nodiscard]] DAW_JSON_CPP23_STATIC_CALL_OP constexpr Decimal
+				operator( )( std::string_view digits )
+				  DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+					return Decimal( digits );
+				}
+			};
+
+			/// @brief ToJsonConverter for json_number_decimal.  The digits are
+			/// formatted in a stack buffer and written as a JSON number with exactly
+			/// Decimal::scale fractional digits
+			template<typename Decimal>
+			struct decimal_to_json_converter {
+				template<typename WriteableType>
+				[[nodiscard]] DAW_JSON_CPP23_STATIC_CALL_OP constexpr WriteableType
+				operator( )( WriteableType it, Decimal const &value )
+				  DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+					using integer_t = typename Decimal::integer_type;
+					using unsigned_t = typename daw::make_unsigned<integer_t>::type;
+					// digits, sign, and decimal point
+					constexpr std::size_t buff_size =
+					  static_cast<std::size_t>(
+					    daw::numeric_limits<unsigned_t>::digits10 ) +
+					  3U;
+					char buff[buff_size]{ };
+					char *const last = buff + buff_size;
+					char *first = last;
+
+					auto const unscaled = value.unscaled( );
+					auto magnitude = unscaled < integer_t{ }
+					                   ? unsigned_t{ } - static_cast<unsigned_t>( unscaled )
+					                   : static_cast<unsigned_t>( unscaled );
+					for( std::size_t n = 0; n < Decimal::scale; ++n ) {
+						*--first = static_cast<char>(
+						  '0' + static_cast<int>( magnitude % unsigned_t{ 10U } ) );
+						magnitude /= unsigned_t{ 10U };
+					}
+					if constexpr( Decimal::scale > 0 ) {
+						*--first = '.';
+					}
+					do {
+						*--first = static_cast<char>(
+						  '0' + static_cast<int>( magnitude % unsigned_t{ 10U } ) );
+						magnitude /= unsigned_t{ 10U };
+					} while( magnitude != unsigned_t{ } );
+					if( unscaled < integer_t{ } ) {
+						*--first = '-';
+					}
+					return utils::copy_to_iterator(
+					  it, std::string_view(
+					        first, static_cast<std::size_t>( last - first ) ) );
+				}
+			};
+		} // namespace json_details
+
+		/***
+		 * @brief Link to a JSON number parsed exactly into a fixed point decimal
+		 * @tparam Name Name of JSON member to link to
+		 * @tparam Decimal basic_json_decimal type to parse to
+		 */
+		template<JSONNAMETYPE Name, typename Decimal = json_decimal<2>>
+		using json_number_decimal =
+		  json_custom_lit<Name, Decimal,
+		                  json_details::decimal_from_json_converter<Decimal>,
+		                  json_details::decimal_to_json_converter<Decimal>>;
+
+		/***
+		 * @brief Link to a nullable JSON number parsed exactly into a fixed point
+		 * decimal
+		 * @tparam Name Name of JSON member to link to
+		 * @tparam WrappedDecimal nullable type holding a basic_json_decimal, e.g.
+		 * std::optional<json_decimal<2>>
+		 */
+		template<JSONNAMETYPE Name,
+		         typename WrappedDecimal = std::optional<json_decimal<2>>,
+		         JsonNullable NullableType = JsonNullable::Nullable,
+		         typename Constructor = use_default>
+		using json_number_decimal_null = json_custom_lit_null<
+		  Name, WrappedDecimal,
+		  json_details::decimal_from_json_converter<
+		    json_details::unwrapped_t<WrappedDecimal>>,
+		  json_details::decimal_to_json_converter<
+		    json_details::unwrapped_t<WrappedDecimal>>,
+		  json_custom_opts_def, NullableType, Constructor>;
+
+		template<typename Decimal = json_decimal<2>>
+		using json_number_decimal_no_name = json_custom_lit_no_name<
+		  Decimal, json_details::decimal_from_json_converter<Decimal>,
+		  json_details::decimal_to_json_converter<Decimal>>;
+
+		template<std::size_t Scale, typename Integer>
+		struct json_data_contract<basic_json_decimal<Scale, Integer>> {
+			using type = json_type_alias<
+			  json_number_decimal_no_name<basic_json_decimal<Scale, Integer>>>;
+		};
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
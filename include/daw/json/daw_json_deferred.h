@@ -0,0 +1,194 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_from_json.h"
+#include "daw_json_link_types.h"
+#include "impl/daw_json_value.h"
+
+#include <daw/daw_string_view.h>
+
+#include <atomic>
+#include <ciso646>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <string_view>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * @brief A JSON value whose parsing is deferred until it is first
+		 * accessed.  When mapped with json_deferred, the range of the value found
+		 * while skipping it is kept along with the number of elements/members of
+		 * an array/class, so neither is rescanned.  Values whose range was
+		 * already known, e.g. a root value or a member found out of order, have
+		 * their elements counted when constructed.  The first call to get( )
+		 * parses the value into a T that is cached for later calls; this is
+		 * thread safe.  It refers to the JSON document, which must outlive it, and
+		 * serializes the original JSON text unchanged.
+		 * @tparam T type the value is parsed to, must have a mapping
+		 * @tparam PolicyFlags parse policy used when parsing to T
+		 */
+		template<typename T,
+		         json_options_t PolicyFlags = json_details::default_policy_flag>
+		class basic_json_deferred {
+			basic_json_value<PolicyFlags> m_value{ };
+			std::size_t m_element_count = 0;
+			mutable std::mutex m_mutex{ };
+			mutable std::atomic<bool> m_is_parsed{ false };
+			mutable std::optional<T> m_parsed{ };
+
+			[[nodiscard]] static std::size_t
+			count_elements( basic_json_value<PolicyFlags> const &jv ) {
+				std::size_t result = 0;
+				if( jv.is_class( ) or jv.is_array( ) ) {
+					for( auto const &jp : jv ) {
+						(void)jp;
+						++result;
+					}
+				}
+				return result;
+			}
+
+			void copy_parsed( basic_json_deferred const &other ) {
+				if( other.m_is_parsed.load( std::memory_order_acquire ) ) {
+					m_parsed = other.m_parsed;
+					m_is_parsed.store( true, std::memory_order_release );
+				} else {
+					m_parsed.reset( );
+					m_is_parsed.store( false, std::memory_order_release );
+				}
+			}
+
+		public:
+			using i_am_a_json_deferred = void;
+			using parsed_type = T;
+
+			basic_json_deferred( ) = default;
+
+			/// @brief Construct from the JSON text of a complete value.  The
+			/// elements/members are counted here
+			basic_json_deferred( char const *first, std::size_t size )
+			  : m_value( daw::string_view( first, size ) )
+			  , m_element_count( count_elements( m_value ) ) {}
+
+			/// @brief Construct from the JSON text of a complete value and the
+			/// number of elements/members already counted by the parser
+			basic_json_deferred( char const *first, std::size_t size,
+			                     std::size_t element_count )
+			  : m_value( daw::string_view( first, size ) )
+			  , m_element_count( element_count ) {}
+
+			basic_json_deferred( basic_json_deferred const &other )
+			  : m_value( other.m_value )
+			  , m_element_count( other.m_element_count ) {
+				copy_parsed( other );
+			}
+
+			basic_json_deferred &operator=( basic_json_deferred const &rhs ) {
+				if( this != &rhs ) {
+					m_value = rhs.m_value;
+					m_element_count = rhs.m_element_count;
+					copy_parsed( rhs );
+				}
+				return *this;
+			}
+
+			~basic_json_deferred( ) = default;
+
+			/// @brief The JSON text of the value
+			[[nodiscard]] std::string_view raw( ) const {
+				return m_value.get_raw_json_document( );
+			}
+
+			/// @brief The JSON value, e.g. to inspect it without parsing to T
+			[[nodiscard]] basic_json_value<PolicyFlags> const &
+			get_json_value( ) const {
+				return m_value;
+			}
+
+			/// @brief Whether the value is a class, array, string, ...
+			[[nodiscard]] JsonBaseParseTypes type( ) const {
+				return m_value.type( );
+			}
+
+			/// @brief Number of members of a class or elements of an array, 0 for
+			/// other values
+			[[nodiscard]] std::size_t element_count( ) const {
+				return m_element_count;
+			}
+
+			/// @brief Has the value been parsed to T yet
+			[[nodiscard]] bool is_parsed( ) const {
+				return m_is_parsed.load( std::memory_order_acquire );
+			}
+
+			/// @brief The value parsed to T.  It is parsed on the first call
+			/// @throws daw::json::json_exception when the value cannot be parsed,
+			/// a later call will try again
+			[[nodiscard]] T const &get( ) const {
+				if( not m_is_parsed.load( std::memory_order_acquire ) ) {
+					auto const lck = std::lock_guard<std::mutex>( m_mutex );
+					if( not m_is_parsed.load( std::memory_order_relaxed ) ) {
+						m_parsed.emplace( from_json<T>( m_value ) );
+						m_is_parsed.store( true, std::memory_order_release );
+					}
+				}
+				return *m_parsed;
+			}
+
+			[[nodiscard]] T const &operator*( ) const {
+				return get( );
+			}
+
+			[[nodiscard]] T const *operator->( ) const {
+				return &get( );
+			}
+
+			/// @brief The JSON text, used when serializing
+			[[nodiscard]] char const *begin( ) const {
+				return raw( ).data( );
+			}
+
+			/// @brief The JSON text, used when serializing
+			[[nodiscard]] char const *end( ) const {
+				auto const r = raw( );
+				return r.data( ) + r.size( );
+			}
+		};
+
+		/***
+		 * @brief Link to a JSON value whose parsing to T is deferred until it is
+		 * accessed.  See basic_json_deferred
+		 * @tparam Name Name of JSON member to link to
+		 * @tparam T type the value is parsed to on access
+		 */
+		template<JSONNAMETYPE Name, typename T>
+		using json_deferred = json_raw<Name, basic_json_deferred<T>>;
+
+		/***
+		 * @brief Link to a nullable JSON value whose parsing to T is deferred
+		 * until it is accessed.  See basic_json_deferred
+		 * @tparam Name Name of JSON member to link to
+		 * @tparam T type the value is parsed to on access
+		 * @tparam WrappedDeferred nullable type holding a basic_json_deferred
+		 */
+		template<JSONNAMETYPE Name, typename T,
+		         typename WrappedDeferred = std::optional<basic_json_deferred<T>>,
+		         JsonNullable NullableType = JsonNullable::Nullable>
+		using json_deferred_null =
+		  json_raw_null<Name, WrappedDeferred, NullableType>;
+
+		template<typename T>
+		using json_deferred_no_name = json_raw_no_name<basic_json_deferred<T>>;
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -11,15 +11,22 @@
 #include "impl/version.h"
 
 #include "daw_from_json_fwd.h"
+#include "daw_json_link_types.h"
 #include "impl/daw_json_parse_policy.h"
+#include "impl/daw_json_parse_string_need_slow.h"
+#include "impl/daw_json_parse_value.h"
+#include "impl/daw_json_skip.h"
 #include "impl/daw_json_value.h"
 
 #include <daw/daw_move.h>
 #include <daw/daw_string_view.h>
 
+#include <array>
 #include <ciso646>
 #include <cstddef>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -161,6 +168,15 @@ namespace daw::json {
 				inline constexpr bool has_on_string_handler_str_v =
 				  daw::is_detected_v<has_on_string_handler_detect_str, Handler>;
 
+				template<typename Handler>
+				using has_on_string_handler_detect_sv =
+				  decltype( std::declval<Handler>( ).handle_on_string(
+				    std::declval<std::string_view>( ) ) );
+
+				template<typename Handler>
+				inline constexpr bool has_on_string_handler_sv_v =
+				  daw::is_detected_v<has_on_string_handler_detect_sv, Handler>;
+
 				// On Null
 				template<typename Handler, typename JValue>
 				using has_on_null_handler_detect_jv =
@@ -316,6 +332,105 @@ namespace daw::json {
 				}
 			}
 
+			/// @brief A json_value of the value at the front of parse_state, as
+			/// basic_json_value_iterator would produce it
+			template<json_options_t P, typename A, typename ParseState>
+			[[nodiscard]] inline constexpr basic_json_value<P, A>
+			sax_json_value( ParseState const &parse_state ) {
+				return basic_json_value<P, A>( ParseState(
+				  parse_state.first, parse_state.last, parse_state.first,
+				  parse_state.last, parse_state.get_allocator( ) ) );
+			}
+
+			/// @brief Consume the number at the front of parse_state.  Handlers
+			/// taking a double get the value parsed in place
+			template<json_options_t P, typename A, typename Handler,
+			         typename ParseState>
+			inline constexpr handler_result_holder
+			sax_handle_on_number( Handler &&handler, ParseState &parse_state ) {
+				if constexpr( hnd_checks::has_on_number_handler_jv_v<Handler, P, A> ) {
+					auto jv = sax_json_value<P, A>( parse_state );
+					(void)skip_number( parse_state );
+					return handler.handle_on_number( DAW_MOVE( jv ) );
+				} else if constexpr( hnd_checks::has_on_number_handler_dbl_v<
+				                       Handler> ) {
+					return handler.handle_on_number(
+					  parse_value_real<json_number_no_name<double>>( parse_state ) );
+				} else {
+					(void)skip_number( parse_state );
+					return handler_result_holder{ };
+				}
+			}
+
+			/// @brief Consume the true/false at the front of parse_state
+			template<json_options_t P, typename A, typename Handler,
+			         typename ParseState>
+			inline constexpr handler_result_holder
+			sax_handle_on_bool( Handler &&handler, ParseState &parse_state ) {
+				auto jv = sax_json_value<P, A>( parse_state );
+				// skip_true/skip_false store the value in the counter
+				auto const value = parse_state.front( ) == 't'
+				                     ? skip_true( parse_state )
+				                     : skip_false( parse_state );
+				if constexpr( hnd_checks::has_on_bool_handler_jv_v<Handler, P, A> ) {
+					return handler.handle_on_bool( DAW_MOVE( jv ) );
+				} else if constexpr( hnd_checks::has_on_bool_handler_bl_v<Handler> ) {
+					return handler.handle_on_bool( static_cast<bool>( value.counter ) );
+				} else {
+					(void)jv;
+					(void)value;
+					return handler_result_holder{ };
+				}
+			}
+
+			/// @brief Consume the string at the front of parse_state.  Handlers
+			/// taking a std::string_view or std::string get the unescaped value.
+			/// Strings without escapes are passed without copying to the former
+			template<json_options_t P, typename A, typename Handler,
+			         typename ParseState>
+			inline constexpr handler_result_holder
+			sax_handle_on_string( Handler &&handler, ParseState &parse_state ) {
+				if constexpr( hnd_checks::has_on_string_handler_jv_v<Handler, P, A> ) {
+					auto jv = sax_json_value<P, A>( parse_state );
+					(void)skip_string( parse_state );
+					return handler.handle_on_string( DAW_MOVE( jv ) );
+				} else if constexpr( hnd_checks::has_on_string_handler_sv_v<Handler> or
+				                     hnd_checks::has_on_string_handler_str_v<
+				                       Handler> ) {
+					auto str = skip_string( parse_state );
+					if( needs_slow_path( str ) ) {
+						auto value =
+						  parse_string_known_stdstring<true, json_string_no_name<>, true>(
+						    str );
+						if constexpr( hnd_checks::has_on_string_handler_sv_v<Handler> ) {
+							return handler.handle_on_string(
+							  std::string_view( std::data( value ), std::size( value ) ) );
+						} else {
+							return handler.handle_on_string( DAW_MOVE( value ) );
+						}
+					}
+					if constexpr( hnd_checks::has_on_string_handler_sv_v<Handler> ) {
+						return handler.handle_on_string(
+						  std::string_view( std::data( str ), std::size( str ) ) );
+					} else {
+						return handler.handle_on_string(
+						  std::string( std::data( str ), std::size( str ) ) );
+					}
+				} else {
+					(void)skip_string( parse_state );
+					return handler_result_holder{ };
+				}
+			}
+
+			/// @brief Consume the null at the front of parse_state
+			template<json_options_t P, typename A, typename Handler,
+			         typename ParseState>
+			inline constexpr handler_result_holder
+			sax_handle_on_null( Handler &&handler, ParseState &parse_state ) {
+				auto jv = sax_json_value<P, A>( parse_state );
+				(void)skip_null( parse_state );
+				return handle_on_null( handler, jv );
+			}
 		} // namespace json_details
 
 		enum class StackParseStateType { Class, Array };
@@ -327,7 +442,14 @@ namespace daw::json {
 			std::pair<iterator, iterator> value;
 		};
 
-		template<typename StackValue>
+		/***
+		 * @brief The default stack used by json_event_parser/json_sax_parser.  It
+		 * holds one value per open class/array and is backed by a std::vector
+		 * @tparam StackValue type of the values held
+		 * @tparam MaxDepth When not 0, the nesting depth of classes/arrays that
+		 * fails with ErrorReason::NestingDepthExceeded
+		 */
+		template<typename StackValue, std::size_t MaxDepth = 0>
 		class DefaultJsonEventParserStackPolicy {
 			std::vector<StackValue> m_stack{ };
 
@@ -340,6 +462,10 @@ namespace daw::json {
 			CPP20CONSTEXPR DefaultJsonEventParserStackPolicy( ) = default;
 
 			CPP20CONSTEXPR void push_back( value_type &&v ) {
+				if constexpr( MaxDepth > 0 ) {
+					daw_json_ensure( m_stack.size( ) < MaxDepth,
+					                 ErrorReason::NestingDepthExceeded );
+				}
 				m_stack.push_back( DAW_MOVE( v ) );
 			}
 
@@ -358,8 +484,108 @@ namespace daw::json {
 			[[nodiscard]] CPP20CONSTEXPR bool empty( ) const {
 				return m_stack.empty( );
 			}
+
+			[[nodiscard]] CPP20CONSTEXPR size_type size( ) const {
+				return m_stack.size( );
+			}
 		};
 
+		/***
+		 * @brief A stack for json_event_parser/json_sax_parser that is stored
+		 * inline and never allocates.  Nesting classes/arrays deeper than MaxDepth
+		 * fails with ErrorReason::NestingDepthExceeded
+		 * @tparam StackValue type of the values held
+		 * @tparam MaxDepth maximum nesting depth of classes/arrays
+		 */
+		template<typename StackValue, std::size_t MaxDepth>
+		class FixedJsonEventParserStackPolicy {
+			static_assert( MaxDepth > 0, "MaxDepth must be at least 1" );
+			std::array<StackValue, MaxDepth> m_stack;
+			std::size_t m_size = 0;
+
+		public:
+			using value_type = StackValue;
+			using reference = StackValue &;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+
+			FixedJsonEventParserStackPolicy( ) = default;
+
+			constexpr void push_back( value_type &&v ) {
+				daw_json_ensure( m_size < MaxDepth, ErrorReason::NestingDepthExceeded );
+				m_stack[m_size] = DAW_MOVE( v );
+				++m_size;
+			}
+
+			[[nodiscard]] constexpr reference back( ) {
+				return m_stack[m_size - 1];
+			}
+
+			constexpr void clear( ) {
+				m_size = 0;
+			}
+
+			constexpr void pop_back( ) {
+				--m_size;
+			}
+
+			[[nodiscard]] constexpr bool empty( ) const {
+				return m_size == 0;
+			}
+
+			[[nodiscard]] constexpr size_type size( ) const {
+				return m_size;
+			}
+		};
+
+		/***
+		 * @brief StackContainerPolicy for json_event_parser/json_sax_parser that
+		 * selects a FixedJsonEventParserStackPolicy, so that parsing does not
+		 * allocate, e.g. json_event_parser<json_event_parser_fixed_stack<64>>(
+		 * json_doc, handler )
+		 * @tparam MaxDepth maximum nesting depth of classes/arrays
+		 */
+		template<std::size_t MaxDepth>
+		struct json_event_parser_fixed_stack {
+			template<typename StackValue>
+			using stack_policy = FixedJsonEventParserStackPolicy<StackValue, MaxDepth>;
+		};
+
+		/***
+		 * @brief StackContainerPolicy for json_event_parser/json_sax_parser that
+		 * selects the default, heap backed, stack with a maximum nesting depth of
+		 * classes/arrays
+		 * @tparam MaxDepth maximum nesting depth of classes/arrays
+		 */
+		template<std::size_t MaxDepth>
+		struct json_event_parser_depth_limit {
+			template<typename StackValue>
+			using stack_policy =
+			  DefaultJsonEventParserStackPolicy<StackValue, MaxDepth>;
+		};
+
+		namespace json_details {
+			template<typename StackContainerPolicy, typename StackValue>
+			using stack_policy_test =
+			  typename StackContainerPolicy::template stack_policy<StackValue>;
+
+			/// @brief Create the stack for an event parser.  StackContainerPolicy is
+			/// use_default, a selector with a stack_policy alias template, or the
+			/// stack type itself
+			template<typename StackContainerPolicy, typename StackValue>
+			[[nodiscard]] constexpr auto make_event_parser_stack( ) {
+				if constexpr( std::is_same_v<StackContainerPolicy, use_default> ) {
+					return DefaultJsonEventParserStackPolicy<StackValue>{ };
+				} else if constexpr( daw::is_detected_v<stack_policy_test,
+				                                        StackContainerPolicy,
+				                                        StackValue> ) {
+					return stack_policy_test<StackContainerPolicy, StackValue>{ };
+				} else {
+					return StackContainerPolicy{ };
+				}
+			}
+		} // namespace json_details
+
 		template<json_options_t P, typename A,
 		         typename StackContainerPolicy = use_default, typename Handler,
 		         auto... ParseFlags>
@@ -377,13 +603,9 @@ namespace daw::json {
 			  JsonEventParserStackValue<ParseState::policy_flags( ), A>;
 			auto jvalue = basic_json_value( bjv );
 
-			auto parent_stack = [] {
-				if constexpr( std::is_same_v<StackContainerPolicy, use_default> ) {
-					return DefaultJsonEventParserStackPolicy<stack_value_t>{ };
-				} else {
-					return StackContainerPolicy{ };
-				}
-			}( );
+			auto parent_stack =
+			  json_details::make_event_parser_stack<StackContainerPolicy,
+			                                        stack_value_t>( );
 			long long class_depth = 0;
 			long long array_depth = 0;
 
@@ -572,26 +794,252 @@ namespace daw::json {
 		         typename StackContainerPolicy = use_default, typename Handler>
 		inline constexpr void json_event_parser( basic_json_value<P, A> bjv,
 		                                         Handler &&handler ) {
-			json_event_parser( DAW_MOVE( bjv ), DAW_FWD( handler ),
-			                   options::parse_flags<> );
+			json_event_parser<P, A, StackContainerPolicy>(
+			  DAW_MOVE( bjv ), DAW_FWD( handler ), options::parse_flags<> );
 		}
 
-		template<typename Handler, auto... ParseFlags>
+		template<typename StackContainerPolicy = use_default, typename Handler,
+		         auto... ParseFlags>
 		inline void
 		json_event_parser( daw::string_view json_document, Handler &&handler,
 		                   options::parse_flags_t<ParseFlags...> pflags ) {
 
-			return json_event_parser( basic_json_value( json_document ),
-			                          DAW_FWD2( Handler, handler ), pflags );
+			return json_event_parser<json_details::default_policy_flag,
+			                         json_details::NoAllocator, StackContainerPolicy>(
+			  basic_json_value<>( json_document ), DAW_FWD2( Handler, handler ),
+			  pflags );
 		}
 
-		template<typename Handler>
+		template<typename StackContainerPolicy = use_default, typename Handler>
 		inline void json_event_parser( daw::string_view json_document,
 		                               Handler &&handler ) {
 
-			return json_event_parser( basic_json_value( json_document ),
-			                          DAW_FWD2( Handler, handler ),
-			                          options::parse_flags<> );
+			return json_event_parser<json_details::default_policy_flag,
+			                         json_details::NoAllocator, StackContainerPolicy>(
+			  basic_json_value<>( json_document ), DAW_FWD2( Handler, handler ),
+			  options::parse_flags<> );
+		}
+
+		/***
+		 * @brief A single pass alternative to json_event_parser.  The same
+		 * handle_on_* callbacks are called in the same order, but the document is
+		 * read once from front to back instead of skipping each class/array before
+		 * descending into it.  Numbers, bools and strings are parsed as they are
+		 * reached, so handlers taking a double, bool, std::string_view or
+		 * std::string receive the parsed value.  std::string_view values refer to
+		 * the document unless the string has escapes, in which case they refer to
+		 * a temporary that lives until the handler returns.
+		 * SkipClassArray skips the rest of the current class/array, as with
+		 * json_event_parser
+		 * @tparam StackContainerPolicy A stack of StackParseStateType, see
+		 * DefaultJsonEventParserStackPolicy
+		 * @param bjv The JSON value to parse
+		 * @param handler The event handler
+		 */
+		template<json_options_t P, typename A,
+		         typename StackContainerPolicy = use_default, typename Handler,
+		         auto... ParseFlags>
+		inline constexpr void
+		json_sax_parser( basic_json_value<P, A> bjv, Handler &&handler,
+		                 options::parse_flags_t<ParseFlags...> ) {
+
+			using ParseState = TryDefaultParsePolicy<typename BasicParsePolicy<
+			  P, A>::template SetPolicyOptions<ParseFlags...>>;
+			constexpr json_options_t policy_flags = ParseState::policy_flags( );
+			using json_pair_t = basic_json_pair<policy_flags, A>;
+
+			auto const raw_state = bjv.get_raw_state( );
+			auto parse_state =
+			  ParseState( raw_state.first, raw_state.last, raw_state.first,
+			              raw_state.last, raw_state.get_allocator( ) );
+			parse_state.trim_left( );
+
+			auto parent_stack =
+			  json_details::make_event_parser_stack<StackContainerPolicy,
+			                                        StackParseStateType>( );
+			bool is_complete = false;
+			// A comma is required before the next member/element
+			bool after_value = false;
+
+			auto const current_value = [&] {
+				return json_details::sax_json_value<policy_flags, A>( parse_state );
+			};
+
+			// Leave parse_state at the closing brace/bracket of the current
+			// class/array
+			auto const skip_rest_of_parent = [&] {
+				if( parent_stack.empty( ) ) {
+					return;
+				}
+				bool const is_class = parent_stack.back( ) == StackParseStateType::Class;
+				char const closing = is_class ? '}' : ']';
+				parse_state.move_next_member_or_end( );
+				while( parse_state.has_more( ) and parse_state.front( ) != closing ) {
+					if( is_class ) {
+						(void)json_details::parse_name( parse_state );
+					}
+					(void)json_details::skip_value( parse_state );
+					parse_state.move_next_member_or_end( );
+				}
+			};
+
+			// Returns true when parsing should carry on with the current value
+			auto const process_result = [&]( json_details::handler_result_holder r,
+			                                 bool value_consumed ) {
+				switch( r.value ) {
+				case json_parse_handler_result::Complete:
+					is_complete = true;
+					return false;
+				case json_parse_handler_result::SkipClassArray:
+					if( not value_consumed ) {
+						(void)json_details::skip_value( parse_state );
+					}
+					skip_rest_of_parent( );
+					return false;
+				case json_parse_handler_result::Continue:
+					break;
+				}
+				return true;
+			};
+
+			auto const process_value = [&]( std::optional<std::string_view> name ) {
+				daw_json_assert_weak( parse_state.has_more( ),
+				                      ErrorReason::UnexpectedEndOfData, parse_state );
+				after_value = true;
+				if( not process_result(
+				      json_details::handle_on_value(
+				        handler, json_pair_t{ name, current_value( ) } ),
+				      false ) ) {
+					return;
+				}
+				switch( parse_state.front( ) ) {
+				case '{':
+					if( process_result(
+					      json_details::handle_on_class_start( handler, current_value( ) ),
+					      false ) ) {
+						parse_state.remove_prefix( );
+						parse_state.trim_left( );
+						parent_stack.push_back( StackParseStateType::Class );
+						after_value = false;
+					}
+					return;
+				case '[':
+					if( process_result(
+					      json_details::handle_on_array_start( handler, current_value( ) ),
+					      false ) ) {
+						parse_state.remove_prefix( );
+						parse_state.trim_left( );
+						parent_stack.push_back( StackParseStateType::Array );
+						after_value = false;
+					}
+					return;
+				case '"':
+					(void)process_result(
+					  json_details::sax_handle_on_string<policy_flags, A>( handler,
+					                                                       parse_state ),
+					  true );
+					return;
+				case 't':
+				case 'f':
+					(void)process_result(
+					  json_details::sax_handle_on_bool<policy_flags, A>( handler,
+					                                                     parse_state ),
+					  true );
+					return;
+				case 'n':
+					(void)process_result(
+					  json_details::sax_handle_on_null<policy_flags, A>( handler,
+					                                                     parse_state ),
+					  true );
+					return;
+				case '-':
+				case '0':
+				case '1':
+				case '2':
+				case '3':
+				case '4':
+				case '5':
+				case '6':
+				case '7':
+				case '8':
+				case '9':
+					(void)process_result(
+					  json_details::sax_handle_on_number<policy_flags, A>( handler,
+					                                                       parse_state ),
+					  true );
+					return;
+				default: {
+					auto result = json_details::handle_on_error( handler, current_value( ) );
+					if( result.value == json_parse_handler_result::Complete ) {
+						is_complete = true;
+						return;
+					}
+					daw_json_error( ErrorReason::InvalidStartOfValue, parse_state );
+				}
+				}
+			};
+
+			process_value( std::nullopt );
+
+			while( not is_complete and not parent_stack.empty( ) ) {
+				parse_state.trim_left( );
+				daw_json_assert_weak( parse_state.has_more( ),
+				                      ErrorReason::UnexpectedEndOfData, parse_state );
+				bool const is_class = parent_stack.back( ) == StackParseStateType::Class;
+				if( parse_state.front( ) == ( is_class ? '}' : ']' ) ) {
+					parse_state.remove_prefix( );
+					parent_stack.pop_back( );
+					after_value = true;
+					auto result = is_class ? json_details::handle_on_class_end( handler )
+					                       : json_details::handle_on_array_end( handler );
+					if( result.value == json_parse_handler_result::Complete ) {
+						is_complete = true;
+					}
+					continue;
+				}
+				if( after_value ) {
+					daw_json_assert_weak( parse_state.front( ) == ',',
+					                      ErrorReason::InvalidEndOfValue, parse_state );
+					parse_state.remove_prefix( );
+					parse_state.trim_left( );
+				}
+				if( is_class ) {
+					auto const name = json_details::parse_name( parse_state );
+					process_value( std::string_view( std::data( name ), std::size( name ) ) );
+				} else {
+					process_value( std::nullopt );
+				}
+			}
+		}
+
+		template<json_options_t P, typename A,
+		         typename StackContainerPolicy = use_default, typename Handler>
+		inline constexpr void json_sax_parser( basic_json_value<P, A> bjv,
+		                                       Handler &&handler ) {
+			json_sax_parser<P, A, StackContainerPolicy>(
+			  DAW_MOVE( bjv ), DAW_FWD( handler ), options::parse_flags<> );
+		}
+
+		template<typename StackContainerPolicy = use_default, typename Handler,
+		         auto... ParseFlags>
+		inline void json_sax_parser( daw::string_view json_document,
+		                             Handler &&handler,
+		                             options::parse_flags_t<ParseFlags...> pflags ) {
+
+			return json_sax_parser<json_details::default_policy_flag,
+			                       json_details::NoAllocator, StackContainerPolicy>(
+			  basic_json_value<>( json_document ), DAW_FWD2( Handler, handler ),
+			  pflags );
+		}
+
+		template<typename StackContainerPolicy = use_default, typename Handler>
+		inline void json_sax_parser( daw::string_view json_document,
+		                             Handler &&handler ) {
+
+			return json_sax_parser<json_details::default_policy_flag,
+			                       json_details::NoAllocator, StackContainerPolicy>(
+			  basic_json_value<>( json_document ), DAW_FWD2( Handler, handler ),
+			  options::parse_flags<> );
 		}
 
 	} // namespace DAW_JSON_VER
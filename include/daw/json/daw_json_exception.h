@@ -10,12 +10,14 @@
 
 #include "impl/version.h"
 
+#include <daw/daw_move.h>
 #include <daw/daw_string_view.h>
 #include <daw/daw_traits.h>
 #include <daw/daw_unreachable.h>
 
 #include <algorithm>
 #include <ciso646>
+#include <cstddef>
 #include <cstdio>
 #include <cstdlib>
 #include <exception>
@@ -23,6 +25,7 @@
 #include <numeric>
 #include <string>
 #include <string_view>
+#include <type_traits>
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
@@ -111,7 +114,9 @@ namespace daw::json {
 			ExpectedMemberNotFound,
 			ExpectedTokenNotFound,
 			UnexpectedJSONVariantType,
-			TrailingComma
+			TrailingComma,
+			UnknownEnumValue,
+			NestingDepthExceeded
 		};
 
 		constexpr std::string_view reason_message( ErrorReason er ) {
@@ -211,6 +216,10 @@ namespace daw::json {
 				return "Unexpected JSON Variant Type"sv;
 			case ErrorReason::TrailingComma:
 				return "Trailing comma"sv;
+			case ErrorReason::UnknownEnumValue:
+				return "Enum value or name is not in the mapping"sv;
+			case ErrorReason::NestingDepthExceeded:
+				return "Classes/arrays are nested deeper than the maximum depth"sv;
 			}
 			DAW_UNREACHABLE( );
 		}
@@ -233,6 +242,17 @@ namespace daw::json {
 				  : token( t ) {}
 			} m_data{ nullptr };
 			char const *m_parse_loc = nullptr;
+			char const *m_doc_start = nullptr;
+			// Immutable and shared so that copying the exception cannot throw.  Each
+			// prepend replaces it
+			std::shared_ptr<std::string const> m_path{ };
+
+			inline void prepend_path( std::string new_path ) {
+				if( m_path ) {
+					new_path += *m_path;
+				}
+				m_path = std::make_shared<std::string const>( DAW_MOVE( new_path ) );
+			}
 
 		public:
 			json_exception( ) = default;
@@ -295,18 +315,90 @@ namespace daw::json {
 			parse_location( ) const {
 				return m_parse_loc;
 			}
+
+			/// @brief The JSON Path, e.g. .a.b[3], of the value being parsed when
+			/// the error occurred.  Only filled in when parsing with
+			/// options::ErrorContext::yes
+			[[nodiscard]] inline std::string_view path( ) const {
+				if( not m_path ) {
+					return { };
+				}
+				return *m_path;
+			}
+
+			/// @brief Was the error context(path and document start) recorded
+			[[nodiscard]] inline bool has_error_context( ) const {
+				return m_doc_start != nullptr;
+			}
+
+			/// @brief The start of the document the error occurred in, only known
+			/// when parsing with options::ErrorContext::yes
+			[[nodiscard]] constexpr char const *document_start( ) const {
+				return m_doc_start;
+			}
+
+			/// @brief The line, starting at 1, of the parse location.  It is
+			/// calculated on each call from the document start and requires the
+			/// document to still be alive.  0 when unknown
+			[[nodiscard]] inline std::size_t line( ) const {
+				if( m_doc_start == nullptr or m_parse_loc == nullptr ) {
+					return 0;
+				}
+				return static_cast<std::size_t>(
+				         std::count( m_doc_start, m_parse_loc, '\n' ) ) +
+				       1U;
+			}
+
+			/// @brief The column, starting at 1, of the parse location.  It is
+			/// calculated on each call from the document start and requires the
+			/// document to still be alive.  0 when unknown
+			[[nodiscard]] inline std::size_t column( ) const {
+				if( m_doc_start == nullptr or m_parse_loc == nullptr ) {
+					return 0;
+				}
+				auto const *line_start = m_parse_loc;
+				while( line_start != m_doc_start and line_start[-1] != '\n' ) {
+					--line_start;
+				}
+				return static_cast<std::size_t>( m_parse_loc - line_start ) + 1U;
+			}
+
+			/// @brief Add the class member being parsed to the front of the path.
+			/// Used by the parser while the exception propagates
+			inline void prepend_member_path( std::string_view name ) {
+				auto new_path = std::string( "." );
+				new_path.append( std::data( name ), std::size( name ) );
+				prepend_path( DAW_MOVE( new_path ) );
+			}
+
+			/// @brief Add the array element being parsed to the front of the path.
+			/// Used by the parser while the exception propagates
+			inline void prepend_index_path( std::size_t index ) {
+				prepend_path( "[" + std::to_string( index ) + "]" );
+			}
+
+			/// @brief Record the document the error occurred in, so that the line
+			/// and column can be calculated.  The first one set is kept
+			inline void set_document_start( char const *doc_start ) {
+				if( m_doc_start == nullptr ) {
+					m_doc_start = doc_start;
+				}
+			}
 			DAW_ATTRIB_INLINE char const *what( ) const noexcept override {
 				// reason_message returns a string_view to a literal
 				return reason_message( m_reason ).data( );
 			}
-			DAW_ATTRIB_INLINE json_exception( json_exception const & ) = default;
+			DAW_ATTRIB_INLINE json_exception( json_exception const & ) noexcept =
+			  default;
 			DAW_ATTRIB_INLINE json_exception( json_exception && ) noexcept = default;
 			DAW_ATTRIB_INLINE json_exception &
-			operator=( json_exception const & ) = default;
+			operator=( json_exception const & ) noexcept = default;
 			DAW_ATTRIB_INLINE json_exception &
 			operator=( json_exception && ) noexcept = default;
 			DAW_ATTRIB_INLINE ~json_exception( ) override = default;
 		};
+		static_assert( std::is_nothrow_copy_constructible_v<json_exception>,
+		               "Copying an exception must not throw" );
 
 		/***
 		 * Helper to provide output formatted information about json_exception
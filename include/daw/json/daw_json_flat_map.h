@@ -0,0 +1,236 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "impl/daw_json_default_constuctor.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/daw_move.h>
+
+#include <algorithm>
+#include <ciso646>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * @brief An insert only, open addressing hash map intended as the
+		 * Container of a json_key_value.  Elements are stored contiguously in
+		 * insertion order and a separate power of 2 sized table of indices is
+		 * probed linearly, so building it allocates two buffers instead of a node
+		 * per member.  With the default Key of std::string_view the keys refer to
+		 * the member names in the JSON document and, as with other string_view
+		 * mappings, are not unescaped.  Use std::string as the Key to own and
+		 * unescape them
+		 * @tparam T mapped type
+		 * @tparam Key key type
+		 * @tparam Hash hasher for Key
+		 * @tparam KeyEqual equality comparison for Key
+		 */
+		template<typename T, typename Key = std::string_view,
+		         typename Hash = std::hash<Key>,
+		         typename KeyEqual = std::equal_to<Key>>
+		class json_flat_map {
+		public:
+			using key_type = Key;
+			using mapped_type = T;
+			using value_type = std::pair<Key, T>;
+			using size_type = std::size_t;
+			using hasher = Hash;
+			using key_equal = KeyEqual;
+			using iterator = typename std::vector<value_type>::iterator;
+			using const_iterator = typename std::vector<value_type>::const_iterator;
+
+		private:
+			static constexpr size_type empty_slot = 0;
+			static constexpr size_type min_slot_count = 16;
+
+			std::vector<value_type> m_values{ };
+			// index + 1 of the value in m_values, or empty_slot
+			std::vector<size_type> m_slots{ };
+
+			[[nodiscard]] size_type home_slot( key_type const &key ) const {
+				return static_cast<size_type>( hasher{ }( key ) ) &
+				       ( m_slots.size( ) - 1U );
+			}
+
+			/// @brief The slot holding key or the empty slot where it would go
+			[[nodiscard]] size_type find_slot( key_type const &key ) const {
+				auto const mask = m_slots.size( ) - 1U;
+				auto pos = home_slot( key );
+				while( m_slots[pos] != empty_slot and
+				       not key_equal{ }( m_values[m_slots[pos] - 1U].first, key ) ) {
+					pos = ( pos + 1U ) & mask;
+				}
+				return pos;
+			}
+
+			// Keep the load factor at or below 1/2
+			[[nodiscard]] static constexpr size_type
+			slot_count_for( size_type count ) noexcept {
+				auto result = min_slot_count;
+				while( result < count * 2U ) {
+					result *= 2U;
+				}
+				return result;
+			}
+
+			void rehash( size_type slot_count ) {
+				m_slots.assign( slot_count, empty_slot );
+				for( size_type n = 0; n < m_values.size( ); ++n ) {
+					m_slots[find_slot( m_values[n].first )] = n + 1U;
+				}
+			}
+
+		public:
+			json_flat_map( ) = default;
+
+			/// @brief Construct from a range of value_type.  When the same key
+			/// appears more than once the first is kept, as with std::unordered_map
+			template<typename Iterator>
+			json_flat_map( Iterator first, Iterator last ) {
+				if constexpr( std::is_base_of_v<std::forward_iterator_tag,
+				                                typename std::iterator_traits<
+				                                  Iterator>::iterator_category> ) {
+					reserve( static_cast<size_type>( std::distance( first, last ) ) );
+				}
+				while( first != last ) {
+					insert( *first );
+					++first;
+				}
+			}
+
+			[[nodiscard]] size_type size( ) const noexcept {
+				return m_values.size( );
+			}
+
+			[[nodiscard]] bool empty( ) const noexcept {
+				return m_values.empty( );
+			}
+
+			[[nodiscard]] iterator begin( ) noexcept {
+				return m_values.begin( );
+			}
+
+			[[nodiscard]] const_iterator begin( ) const noexcept {
+				return m_values.begin( );
+			}
+
+			[[nodiscard]] const_iterator cbegin( ) const noexcept {
+				return m_values.cbegin( );
+			}
+
+			[[nodiscard]] iterator end( ) noexcept {
+				return m_values.end( );
+			}
+
+			[[nodiscard]] const_iterator end( ) const noexcept {
+				return m_values.end( );
+			}
+
+			[[nodiscard]] const_iterator cend( ) const noexcept {
+				return m_values.cend( );
+			}
+
+			/// @brief Size the map so that count elements can be inserted without
+			/// reallocating or rehashing
+			void reserve( size_type count ) {
+				m_values.reserve( count );
+				if( auto const slot_count = slot_count_for( count );
+				    slot_count > m_slots.size( ) ) {
+					rehash( slot_count );
+				}
+			}
+
+			/// @brief Remove all elements, keeping the allocated capacity
+			void clear( ) noexcept {
+				m_values.clear( );
+				std::fill( m_slots.begin( ), m_slots.end( ), empty_slot );
+			}
+
+			[[nodiscard]] iterator find( key_type const &key ) {
+				if( m_values.empty( ) ) {
+					return end( );
+				}
+				auto const idx = m_slots[find_slot( key )];
+				if( idx == empty_slot ) {
+					return end( );
+				}
+				return std::next( begin( ), static_cast<std::ptrdiff_t>( idx - 1U ) );
+			}
+
+			[[nodiscard]] const_iterator find( key_type const &key ) const {
+				if( m_values.empty( ) ) {
+					return end( );
+				}
+				auto const idx = m_slots[find_slot( key )];
+				if( idx == empty_slot ) {
+					return end( );
+				}
+				return std::next( begin( ), static_cast<std::ptrdiff_t>( idx - 1U ) );
+			}
+
+			[[nodiscard]] bool contains( key_type const &key ) const {
+				return find( key ) != end( );
+			}
+
+			[[nodiscard]] size_type count( key_type const &key ) const {
+				return contains( key ) ? 1U : 0U;
+			}
+
+			/// @brief Insert key/value if key is not already in the map
+			/// @return The position of key and whether the value was inserted
+			template<typename K, typename... Args>
+			std::pair<iterator, bool> emplace( K &&key, Args &&...args ) {
+				// Keep the load factor at or below 1/2, the slot count is a power of 2
+				if( ( m_values.size( ) + 1U ) * 2U > m_slots.size( ) ) {
+					rehash( m_slots.empty( ) ? min_slot_count : m_slots.size( ) * 2U );
+				}
+				auto const pos = find_slot( key );
+				if( m_slots[pos] != empty_slot ) {
+					return { std::next( begin( ),
+					                    static_cast<std::ptrdiff_t>( m_slots[pos] - 1U ) ),
+					         false };
+				}
+				m_values.emplace_back( std::piecewise_construct,
+				                       std::forward_as_tuple( DAW_FWD( key ) ),
+				                       std::forward_as_tuple( DAW_FWD( args )... ) );
+				m_slots[pos] = m_values.size( );
+				return { std::prev( end( ) ), true };
+			}
+
+			std::pair<iterator, bool> insert( value_type const &value ) {
+				return emplace( value.first, value.second );
+			}
+
+			std::pair<iterator, bool> insert( value_type &&value ) {
+				return emplace( DAW_MOVE( value.first ), DAW_MOVE( value.second ) );
+			}
+
+			/// @brief The value of key, inserting a default constructed one if it is
+			/// not in the map
+			mapped_type &operator[]( key_type const &key ) {
+				return emplace( key ).first->second;
+			}
+		};
+
+		template<typename T, typename Key, typename Hash, typename KeyEqual>
+		inline constexpr bool
+		  presize_key_value_v<json_flat_map<T, Key, Hash, KeyEqual>> = true;
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
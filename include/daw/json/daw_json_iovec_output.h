@@ -0,0 +1,161 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "concepts/daw_writable_output.h"
+#include "daw_json_exception.h"
+#include "impl/daw_json_assert.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cerrno>
+#include <ciso646>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+#include <sys/uio.h>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * @brief A writable output to a POSIX file descriptor, e.g. a socket or
+		 * file, that uses writev.  Small writes are copied into a buffer.  Writes
+		 * of at least LargeSize characters, e.g. long strings that need no
+		 * escaping or raw JSON, are not copied; they are passed to writev in
+		 * place along with the buffered data.  flush( ) must be called when done
+		 * to write the remaining buffer and see any output errors, the destructor
+		 * flushes and ignores them.
+		 * @tparam BufferSize size of the buffer for small writes
+		 * @tparam LargeSize writes of at least this size are not copied
+		 */
+		template<std::size_t BufferSize = 16384, std::size_t LargeSize = 2048>
+		class basic_iovec_output {
+			static_assert( LargeSize > 0 and LargeSize <= BufferSize );
+
+			int m_fd;
+			std::size_t m_size = 0;
+			std::size_t m_bytes_written = 0;
+			char m_buffer[BufferSize];
+
+			void write_all( ::iovec *iov, int count ) {
+				while( count > 0 ) {
+					auto const result = ::writev( m_fd, iov, count );
+					if( result < 0 ) {
+						if( errno == EINTR ) {
+							continue;
+						}
+						daw_json_error( ErrorReason::OutputError );
+					}
+					auto written = static_cast<std::size_t>( result );
+					m_bytes_written += written;
+					while( count > 0 and written >= iov->iov_len ) {
+						written -= iov->iov_len;
+						++iov;
+						--count;
+					}
+					if( count > 0 ) {
+						// Partial write of an iovec
+						iov->iov_base = static_cast<char *>( iov->iov_base ) + written;
+						iov->iov_len -= written;
+					}
+				}
+			}
+
+		public:
+			/// @param fd file descriptor open for writing, it is not closed
+			explicit basic_iovec_output( int fd )
+			  : m_fd( fd ) {}
+
+			basic_iovec_output( basic_iovec_output const & ) = delete;
+			basic_iovec_output &operator=( basic_iovec_output const & ) = delete;
+
+			~basic_iovec_output( ) {
+#if defined( DAW_USE_EXCEPTIONS )
+				try {
+#endif
+					flush( );
+#if defined( DAW_USE_EXCEPTIONS )
+				} catch( ... ) {}
+#endif
+			}
+
+			/// @brief Write the buffered data
+			void flush( ) {
+				if( m_size > 0 ) {
+					auto iov = ::iovec{ m_buffer, m_size };
+					m_size = 0;
+					write_all( &iov, 1 );
+				}
+			}
+
+			void write( daw::string_view sv ) {
+				if( sv.size( ) >= LargeSize ) {
+					// The buffered data must be written first, the large range is
+					// written in place by the same call
+					::iovec iov[2]{
+					  { m_buffer, m_size },
+					  { const_cast<char *>( sv.data( ) ), sv.size( ) } };
+					bool const has_buffered = m_size > 0;
+					m_size = 0;
+					if( has_buffered ) {
+						write_all( iov, 2 );
+					} else {
+						write_all( iov + 1, 1 );
+					}
+					return;
+				}
+				if( sv.size( ) > BufferSize - m_size ) {
+					flush( );
+				}
+				if( not sv.empty( ) ) {
+					std::memcpy( m_buffer + m_size, sv.data( ), sv.size( ) );
+					m_size += sv.size( );
+				}
+			}
+
+			void put( char c ) {
+				if( m_size == BufferSize ) {
+					flush( );
+				}
+				m_buffer[m_size++] = c;
+			}
+
+			/// @brief Number of characters passed to the file descriptor so far
+			[[nodiscard]] std::size_t bytes_written( ) const {
+				return m_bytes_written;
+			}
+		};
+
+		using iovec_output = basic_iovec_output<>;
+
+		namespace concepts {
+			/// @brief Specialization for basic_iovec_output
+			template<std::size_t BufferSize, std::size_t LargeSize>
+			struct writable_output_trait<basic_iovec_output<BufferSize, LargeSize>>
+			  : std::true_type {
+				using output_t = basic_iovec_output<BufferSize, LargeSize>;
+
+				template<typename... StringViews>
+				static inline void write( output_t &out, StringViews const &...svs ) {
+					static_assert( sizeof...( StringViews ) > 0 );
+					( out.write( daw::string_view( std::data( svs ), std::size( svs ) ) ),
+					  ... );
+				}
+
+				static inline void put( output_t &out, char c ) {
+					out.put( c );
+				}
+			};
+		} // namespace concepts
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,232 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_from_json.h"
+#include "daw_json_link_types.h"
+
+#include <daw/daw_attributes.h>
+
+#include <ciso646>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief The parts of a JSON number, as they appear in the document.  This
+		/// is enough to construct an arbitrary precision decimal without loss
+		struct json_number_parts {
+			bool is_negative = false;
+			/// @brief Digits before the decimal point, never empty
+			std::string_view whole{ };
+			/// @brief Digits after the decimal point, empty when there are none
+			std::string_view fraction{ };
+			/// @brief Exponent digits, including any sign, empty when there are none
+			std::string_view exponent{ };
+		};
+
+		namespace json_details {
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr bool
+			is_lazy_number_digit( char c ) {
+				return static_cast<unsigned char>( c - '0' ) < 10U;
+			}
+
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr std::size_t
+			count_lazy_number_digits( std::string_view str, std::size_t pos ) {
+				auto const first = pos;
+				while( pos < str.size( ) and is_lazy_number_digit( str[pos] ) ) {
+					++pos;
+				}
+				return pos - first;
+			}
+
+			/// @brief Split a number into its parts, checking that it follows the
+			/// JSON number grammar.
+			/// -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+			/// @throws daw::json::json_exception when str is not a JSON number
+			[[nodiscard]] constexpr json_number_parts
+			split_lazy_number( std::string_view str ) {
+				auto result = json_number_parts{ };
+				std::size_t pos = 0;
+				if( pos < str.size( ) and str[pos] == '-' ) {
+					result.is_negative = true;
+					++pos;
+				}
+				auto const whole_size = count_lazy_number_digits( str, pos );
+				daw_json_ensure( whole_size > 0, ErrorReason::InvalidNumberStart );
+				daw_json_ensure( whole_size == 1 or str[pos] != '0',
+				                 ErrorReason::InvalidNumber );
+				result.whole = str.substr( pos, whole_size );
+				pos += whole_size;
+				if( pos < str.size( ) and str[pos] == '.' ) {
+					++pos;
+					auto const fraction_size = count_lazy_number_digits( str, pos );
+					daw_json_ensure( fraction_size > 0, ErrorReason::InvalidNumber );
+					result.fraction = str.substr( pos, fraction_size );
+					pos += fraction_size;
+				}
+				if( pos < str.size( ) and ( str[pos] == 'e' or str[pos] == 'E' ) ) {
+					++pos;
+					auto const exp_first = pos;
+					if( pos < str.size( ) and ( str[pos] == '-' or str[pos] == '+' ) ) {
+						++pos;
+					}
+					auto const exp_size = count_lazy_number_digits( str, pos );
+					daw_json_ensure( exp_size > 0, ErrorReason::InvalidNumber );
+					pos += exp_size;
+					result.exponent = str.substr( exp_first, pos - exp_first );
+				}
+				daw_json_ensure( pos == str.size( ), ErrorReason::InvalidNumber );
+				return result;
+			}
+		} // namespace json_details
+
+		/***
+		 * @brief A JSON number that is validated when parsed but only converted
+		 * when it is accessed.  It refers to the characters of the number in the
+		 * JSON document, so the document must outlive it, and serializes them
+		 * unchanged.
+		 * @tparam Options json_number options, e.g. the range check, used when
+		 * converting
+		 */
+		template<json_options_t Options = number_opts_def>
+		class basic_json_lazy_number {
+			std::string_view m_digits = "0";
+
+		public:
+			constexpr basic_json_lazy_number( ) = default;
+
+			/// @pre digits is a JSON number, see json_number_lazy
+			explicit constexpr basic_json_lazy_number( std::string_view digits )
+			  : m_digits( digits ) {}
+
+			/// @brief The number as it appeared in the JSON document
+			[[nodiscard]] constexpr std::string_view raw( ) const {
+				return m_digits;
+			}
+
+			/// @brief True when the number has no fraction or exponent
+			[[nodiscard]] constexpr bool is_integer( ) const {
+				auto const p = parts( );
+				return p.fraction.empty( ) and p.exponent.empty( );
+			}
+
+			/// @brief The sign, whole, fraction, and exponent of the number
+			[[nodiscard]] constexpr json_number_parts parts( ) const {
+				return json_details::split_lazy_number( m_digits );
+			}
+
+			/// @brief Convert to Number using this number's options
+			/// @tparam Number An arithmetic type supported by json_number
+			/// @throws daw::json::json_exception when the value does not fit
+			template<typename Number, auto... PolicyFlags>
+			[[nodiscard]] constexpr Number
+			as( options::parse_flags_t<PolicyFlags...> flags ) const {
+				return from_json<json_number_no_name<Number, Options>>( m_digits,
+				                                                        flags );
+			}
+
+			template<typename Number>
+			[[nodiscard]] constexpr Number as( ) const {
+				return as<Number>( options::parse_flags<> );
+			}
+
+			[[nodiscard]] constexpr double as_double( ) const {
+				return as<double>( );
+			}
+
+			[[nodiscard]] constexpr std::int64_t as_int64( ) const {
+				return as<std::int64_t>( );
+			}
+
+			[[nodiscard]] constexpr bool
+			operator==( basic_json_lazy_number const &rhs ) const {
+				return m_digits == rhs.m_digits;
+			}
+
+			[[nodiscard]] constexpr bool
+			operator!=( basic_json_lazy_number const &rhs ) const {
+				return m_digits != rhs.m_digits;
+			}
+		};
+
+		using json_lazy_number = basic_json_lazy_number<>;
+
+		namespace json_details {
+			/// @brief FromJsonConverter for json_number_lazy.  The grammar is checked
+			/// but no conversion happens
+			template<typename LazyNumber>
+			struct lazy_number_from_json_converter {
+				[[nodiscard]] DAW_JSON_CPP23_STATIC_CALL_OP constexpr LazyNumber
+				operator( )( std::string_view digits )
+				  DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+					(void)split_lazy_number( digits );
+					return LazyNumber( digits );
+				}
+			};
+
+			/// @brief ToJsonConverter for json_number_lazy.  The original characters
+			/// are written
+			template<typename LazyNumber>
+			struct lazy_number_to_json_converter {
+				[[nodiscard]] DAW_JSON_CPP23_STATIC_CALL_OP constexpr std::string_view
+				operator( )( LazyNumber const &value )
+				  DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+					return value.raw( );
+				}
+			};
+		} // namespace json_details
+
+		/***
+		 * @brief Link to a JSON number whose conversion is deferred until it is
+		 * accessed.  The number grammar is checked while parsing
+		 * @tparam Name Name of JSON member to link to
+		 * @tparam LazyNumber basic_json_lazy_number type to parse to
+		 */
+		template<JSONNAMETYPE Name, typename LazyNumber = json_lazy_number>
+		using json_number_lazy = json_custom_lit<
+		  Name, LazyNumber,
+		  json_details::lazy_number_from_json_converter<LazyNumber>,
+		  json_details::lazy_number_to_json_converter<LazyNumber>>;
+
+		/***
+		 * @brief Link to a nullable JSON number whose conversion is deferred until
+		 * it is accessed
+		 * @tparam Name Name of JSON member to link to
+		 * @tparam WrappedLazyNumber nullable type holding a basic_json_lazy_number,
+		 * e.g. std::optional<json_lazy_number>
+		 */
+		template<JSONNAMETYPE Name,
+		         typename WrappedLazyNumber = std::optional<json_lazy_number>,
+		         JsonNullable NullableType = JsonNullable::Nullable,
+		         typename Constructor = use_default>
+		using json_number_lazy_null = json_custom_lit_null<
+		  Name, WrappedLazyNumber,
+		  json_details::lazy_number_from_json_converter<
+		    json_details::unwrapped_t<WrappedLazyNumber>>,
+		  json_details::lazy_number_to_json_converter<
+		    json_details::unwrapped_t<WrappedLazyNumber>>,
+		  json_custom_opts_def, NullableType, Constructor>;
+
+		template<typename LazyNumber = json_lazy_number>
+		using json_number_lazy_no_name = json_custom_lit_no_name<
+		  LazyNumber, json_details::lazy_number_from_json_converter<LazyNumber>,
+		  json_details::lazy_number_to_json_converter<LazyNumber>>;
+
+		template<json_options_t Options>
+		struct json_data_contract<basic_json_lazy_number<Options>> {
+			using type = json_type_alias<
+			  json_number_lazy_no_name<basic_json_lazy_number<Options>>>;
+		};
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,162 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "concepts/daw_writable_output.h"
+#include "daw_to_json.h"
+#include "impl/daw_json_buffered_output.h"
+#include "impl/daw_json_serialize_policy.h"
+
+#include <daw/daw_traits.h>
+
+#include <ciso646>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * @brief Write values as JSON Lines, one minified JSON document per line,
+		 * as they are produced.  The records are serialized directly into a
+		 * buffer that is passed to the output in blocks, there is no temporary
+		 * per record.  flush( ) must be called to see output errors, the
+		 * destructor flushes and ignores them.  When serializing a record throws
+		 * its partial text is discarded, unless the record was larger than the
+		 * buffer and part of it was already passed to the output.  The output
+		 * then ends in a partial line and is corrupt.
+		 * @tparam WritableType output type with a writable_output_trait, e.g.
+		 * std::string, std::ostream or FILE *
+		 * @tparam PolicyFlags output options, the SerializationFormat is always
+		 * Minified
+		 */
+		template<typename WritableType,
+		         json_options_t PolicyFlags =
+		           json_details::serialization::default_policy_flag>
+		class json_lines_writer {
+			static_assert(
+			  concepts::is_writable_output_type_v<WritableType>,
+			  "Output type does not have a writeable_output_trait specialization" );
+			using buffer_t = json_details::buffered_output<WritableType>;
+			static constexpr json_options_t policy_flags =
+			  json_details::serialization::set_bits(
+			    PolicyFlags, options::SerializationFormat::Minified );
+
+			buffer_t m_buffer;
+
+		public:
+			explicit json_lines_writer( WritableType &writable )
+			  : m_buffer( writable ) {}
+
+			template<auto... Flags>
+			json_lines_writer( WritableType &writable,
+			                   options::output_flags_t<Flags...> )
+			  : m_buffer( writable ) {}
+
+			json_lines_writer( json_lines_writer const & ) = delete;
+			json_lines_writer &operator=( json_lines_writer const & ) = delete;
+
+			~json_lines_writer( ) {
+#if defined( DAW_USE_EXCEPTIONS )
+				try {
+#endif
+					m_buffer.flush( );
+#if defined( DAW_USE_EXCEPTIONS )
+				} catch( ... ) {}
+#endif
+			}
+
+			/// @brief Serialize value followed by a newline
+			/// @tparam JsonElement mapping of value, defaults to deducing it
+			template<typename JsonElement = use_default, typename Value>
+			void write( Value const &value ) {
+				using JsonMember = typename std::conditional_t<
+				  std::is_same_v<JsonElement, use_default>,
+				  json_details::ident_trait<json_details::json_deduced_type, Value>,
+				  json_details::ident_trait<json_details::json_deduced_type,
+				                            JsonElement>>::type;
+				auto out_it = serialization_policy<buffer_t, policy_flags>( m_buffer );
+#if defined( DAW_USE_EXCEPTIONS )
+				auto const record_start = m_buffer.position( );
+				try {
+#endif
+					(void)json_details::member_to_string( template_arg<JsonMember>,
+					                                      out_it, value );
+#if defined( DAW_USE_EXCEPTIONS )
+				} catch( ... ) {
+					(void)m_buffer.discard_after( record_start );
+					throw;
+				}
+#endif
+				m_buffer.put( '\n' );
+			}
+
+			/// @brief Pass the buffered records to the output
+			void flush( ) {
+				m_buffer.flush( );
+			}
+		};
+
+		template<typename WritableType>
+		json_lines_writer( WritableType & ) -> json_lines_writer<WritableType>;
+
+		template<typename WritableType, auto... Flags>
+		json_lines_writer( WritableType &, options::output_flags_t<Flags...> )
+		  -> json_lines_writer<WritableType,
+		                       options::output_flags_t<Flags...>::value>;
+
+		/***
+		 * @brief Serialize the elements of a container as JSON Lines, one
+		 * minified JSON document per line.  See json_lines_writer
+		 * @tparam JsonElement mapping of the elements, defaults to deducing it
+		 * @param c Container of values to serialize
+		 * @param it writable output to write the JSON Lines to
+		 * @return it after writing
+		 */
+		template<typename JsonElement = use_default, typename Container,
+		         typename WritableType, auto... PolicyFlags,
+		         std::enable_if_t<concepts::is_writable_output_type_v<
+		                            daw::remove_cvref_t<WritableType>>,
+		                          std::nullptr_t> = nullptr>
+		daw::rvalue_to_value_t<WritableType>
+		to_json_lines( Container const &c, WritableType &&it,
+		               options::output_flags_t<PolicyFlags...> flgs =
+		                 options::output_flags<> ) {
+			static_assert(
+			  traits::is_container_like_v<daw::remove_cvref_t<Container>>,
+			  "Supplied container must support begin( )/end( )" );
+			if constexpr( std::is_pointer_v<daw::remove_cvref_t<WritableType>> ) {
+				daw_json_ensure( it != nullptr, ErrorReason::NullOutputIterator );
+			}
+			auto writer = json_lines_writer( it, flgs );
+			for( auto const &value : c ) {
+				writer.template write<JsonElement>( value );
+			}
+			writer.flush( );
+			return it;
+		}
+
+		/***
+		 * @brief Serialize the elements of a container as JSON Lines.  See
+		 * to_json_lines
+		 * @return A std::string containing the JSON Lines
+		 */
+		template<typename JsonElement = use_default, typename Container,
+		         auto... PolicyFlags>
+		std::string to_json_lines( Container const &c,
+		                           options::output_flags_t<PolicyFlags...> flgs =
+		                             options::output_flags<> ) {
+			std::string result{ };
+			(void)to_json_lines<JsonElement>( c, result, flgs );
+			return result;
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
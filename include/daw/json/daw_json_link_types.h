@@ -1258,6 +1258,26 @@ namespace daw::json {
 		                           Options, options::JsonCustomTypes::Literal>>,
 		  NullableType, Constructor>;
 
+		template<typename Enum, typename EnumNames = use_default>
+		using json_enum_no_name = json_base::json_custom<
+		  Enum, json_details::enum_from_json_converter<Enum, EnumNames>,
+		  json_details::enum_to_json_converter<Enum, EnumNames>,
+		  json_custom_opts_def>;
+
+		template<typename WrappedEnum, typename EnumNames = use_default,
+		         JsonNullable NullableType = JsonNullable::Nullable,
+		         typename Constructor = use_default>
+		using json_enum_null_no_name = json_base::json_nullable<
+		  WrappedEnum,
+		  json_base::json_custom<
+		    json_details::unwrapped_t<WrappedEnum>,
+		    json_details::enum_from_json_converter<
+		      json_details::unwrapped_t<WrappedEnum>, EnumNames>,
+		    json_details::enum_to_json_converter<
+		      json_details::unwrapped_t<WrappedEnum>, EnumNames>,
+		    json_custom_opts_def>,
+		  NullableType, Constructor>;
+
 		namespace json_base {
 			template<typename JsonElement, typename Container, typename Constructor>
 			struct json_array {
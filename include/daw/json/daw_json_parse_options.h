@@ -149,6 +149,17 @@ namespace daw::json {
 				/// default: no
 				///
 				enum class ExcludeSpecialEscapes : unsigned { no, yes }; // 1bit
+
+				///
+				/// @brief When a json_exception is thrown, record the JSON Path of the
+				/// member/element being parsed and the document start so that the
+				/// line/column can be calculated.  The path is built while the
+				/// exception propagates, so this only costs when there is an error and
+				/// no second parse of the document is needed
+				///
+				/// default: no
+				///
+				enum class ErrorContext : unsigned { no, yes }; // 1bit
 			} // namespace parser_options
 		}   // namespace options
 	}     // namespace DAW_JSON_VER
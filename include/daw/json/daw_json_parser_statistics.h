@@ -0,0 +1,189 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/daw_is_constant_evaluated.h>
+
+#include <ciso646>
+#include <cstddef>
+
+#if defined( DAW_JSON_PARSER_STATISTICS )
+#include <map>
+#include <typeindex>
+#include <typeinfo>
+#endif
+
+/***
+ * Parser statistics are counted when DAW_JSON_PARSER_STATISTICS is defined.
+ * Otherwise the counting functions are empty and compile to nothing.  When
+ * enabled, json_data_contract mapped classes cannot be parsed in a constant
+ * expression
+ */
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * @brief Counts of what the parser did while parsing a class.  Each count
+		 * is for the innermost class being parsed
+		 */
+		struct parser_statistics {
+			/// @brief Number of JSON objects parsed to the class
+			std::size_t classes_parsed = 0;
+			/// @brief Size of the JSON objects parsed, including nested values
+			std::size_t class_bytes = 0;
+			/// @brief Members in the JSON that are not in the mapping
+			std::size_t unknown_members = 0;
+			/// @brief Size of the values of unknown members that were skipped
+			std::size_t skipped_bytes = 0;
+			/// @brief Members found before the member being looked for, their
+			/// positions are stored and they are parsed later.  Ordering the
+			/// mapping like the JSON documents avoids these
+			std::size_t out_of_order_members = 0;
+			/// @brief Names whose hash matched a member with a different name.  Only
+			/// counted when names are compared, e.g. in debug builds
+			std::size_t hash_collisions = 0;
+			/// @brief Strings that had escapes or needed checking and took the
+			/// slow path
+			std::size_t escaped_strings = 0;
+			/// @brief Real numbers that could not be parsed exactly and used strtod
+			std::size_t strtod_fallbacks = 0;
+			/// @brief Times a std::vector grew while being filled from a JSON array
+			std::size_t container_reallocations = 0;
+		};
+
+		namespace json_details {
+			enum class parser_statistic {
+				unknown_members,
+				skipped_bytes,
+				out_of_order_members,
+				hash_collisions,
+				escaped_strings,
+				strtod_fallbacks,
+				container_reallocations
+			};
+		} // namespace json_details
+
+#if defined( DAW_JSON_PARSER_STATISTICS )
+		inline constexpr bool parser_statistics_enabled = true;
+
+		/// @brief The statistics of the current thread, by the type of the
+		/// json_data_contract mapped class.  Counts outside of any class are under
+		/// typeid( void )
+		using parser_statistics_map = std::map<std::type_index, parser_statistics>;
+
+		namespace json_details {
+			inline parser_statistics_map &thread_parser_statistics( ) {
+				thread_local auto result = parser_statistics_map( );
+				return result;
+			}
+
+			/// @brief The statistics of the innermost class being parsed
+			inline parser_statistics *&current_parser_statistics( ) {
+				thread_local parser_statistics *result = nullptr;
+				return result;
+			}
+
+			inline void count_parser_statistic_impl( parser_statistic stat,
+			                                         std::size_t count ) {
+				auto *stats = current_parser_statistics( );
+				if( stats == nullptr ) {
+					stats = &thread_parser_statistics( )[typeid( void )];
+				}
+				switch( stat ) {
+				case parser_statistic::unknown_members:
+					stats->unknown_members += count;
+					break;
+				case parser_statistic::skipped_bytes:
+					stats->skipped_bytes += count;
+					break;
+				case parser_statistic::out_of_order_members:
+					stats->out_of_order_members += count;
+					break;
+				case parser_statistic::hash_collisions:
+					stats->hash_collisions += count;
+					break;
+				case parser_statistic::escaped_strings:
+					stats->escaped_strings += count;
+					break;
+				case parser_statistic::strtod_fallbacks:
+					stats->strtod_fallbacks += count;
+					break;
+				case parser_statistic::container_reallocations:
+					stats->container_reallocations += count;
+					break;
+				}
+			}
+
+			template<parser_statistic Stat>
+			DAW_ATTRIB_INLINE constexpr void
+			count_parser_statistic( std::size_t count = 1 ) {
+#if defined( DAW_IS_CONSTANT_EVALUATED )
+				if( DAW_IS_CONSTANT_EVALUATED( ) ) {
+					return;
+				}
+#endif
+				count_parser_statistic_impl( Stat, count );
+			}
+
+			/***
+			 * @brief Makes T's statistics current while a class is parsed and counts
+			 * the class and its size
+			 */
+			template<typename T>
+			class class_statistics_scope {
+				parser_statistics *m_previous;
+				parser_statistics *m_stats;
+				char const *m_first;
+				char const *const *m_position;
+
+			public:
+				template<typename ParseState>
+				explicit class_statistics_scope( ParseState const &parse_state )
+				  : m_previous( current_parser_statistics( ) )
+				  , m_stats( &thread_parser_statistics( )[typeid( T )] )
+				  , m_first( parse_state.first )
+				  , m_position( &parse_state.first ) {
+					current_parser_statistics( ) = m_stats;
+				}
+
+				class_statistics_scope( class_statistics_scope const & ) = delete;
+				class_statistics_scope &
+				operator=( class_statistics_scope const & ) = delete;
+
+				~class_statistics_scope( ) {
+					++m_stats->classes_parsed;
+					m_stats->class_bytes +=
+					  static_cast<std::size_t>( *m_position - m_first );
+					current_parser_statistics( ) = m_previous;
+				}
+			};
+		} // namespace json_details
+
+		/// @brief The parser statistics counted on the current thread
+		inline parser_statistics_map const &get_parser_statistics( ) {
+			return json_details::thread_parser_statistics( );
+		}
+
+		/// @brief Clear the parser statistics of the current thread
+		inline void reset_parser_statistics( ) {
+			json_details::thread_parser_statistics( ).clear( );
+		}
+#else
+		inline constexpr bool parser_statistics_enabled = false;
+
+		namespace json_details {
+			template<parser_statistic>
+			DAW_ATTRIB_INLINE constexpr void
+			count_parser_statistic( std::size_t = 1 ) {}
+		} // namespace json_details
+#endif
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,148 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "concepts/daw_writable_output.h"
+#include "daw_json_exception.h"
+#include "daw_to_json_fwd.h"
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_buffered_output.h"
+#include "impl/daw_json_parse_policy.h"
+#include "impl/daw_json_reformat_impl.h"
+#include "impl/daw_json_serialize_policy.h"
+#include "impl/daw_json_traits.h"
+
+#include <daw/daw_string_view.h>
+#include <daw/daw_traits.h>
+
+#include <ciso646>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			template<typename ParseState, typename String, typename OutputPolicy>
+			void reformat_document( String const &json_data, OutputPolicy &out_it ) {
+				daw_json_ensure( std::data( json_data ) != nullptr,
+				                 ErrorReason::EmptyJSONDocument );
+				auto parse_state =
+				  ParseState( std::data( json_data ), daw::data_end( json_data ) );
+				parse_state.trim_left_checked( );
+				daw_json_ensure( parse_state.has_more( ),
+				                 ErrorReason::EmptyJSONDocument );
+				reformat_json( parse_state, out_it );
+				parse_state.trim_left_checked( );
+				daw_json_ensure( parse_state.empty( ), ErrorReason::InvalidEndOfValue,
+				                 parse_state );
+			}
+		} // namespace json_details
+
+		/***
+		 * @brief Rewrite any JSON document with the whitespace of the output
+		 * options, without a mapping.  Strings, numbers and literals are copied
+		 * unchanged and brackets are checked to match, other errors in the tokens
+		 * are not detected.  Comments are removed when the parse policy allows
+		 * them
+		 * @param json_data JSON document to reformat
+		 * @param it writable output, e.g. a std::string, std::ostream or char *
+		 * @param output_flags SerializationFormat, IndentationType and
+		 * NewLineDelimiter of the result
+		 * @param parse_flags parse options used to read json_data
+		 * @return the output after writing, e.g. the end of the output for char *
+		 * @throws daw::json::json_exception on unbalanced brackets or a missing
+		 * ':' after a member name
+		 */
+		template<typename String, typename WritableType, auto... OutputFlags,
+		         auto... ParseFlags>
+		daw::rvalue_to_value_t<WritableType>
+		json_reformat( String &&json_data, WritableType &&it,
+		               options::output_flags_t<OutputFlags...>,
+		               options::parse_flags_t<ParseFlags...> ) {
+			static_assert(
+			  json_details::is_string_view_like_v<String>,
+			  "String type must have a be a contiguous range of Characters" );
+			using writable_t = daw::remove_cvref_t<WritableType>;
+			static_assert(
+			  concepts::is_writable_output_type_v<writable_t>,
+			  "Output type does not have a writeable_output_trait specialization" );
+			using ParseState = TryDefaultParsePolicy<
+			  BasicParsePolicy<options::parse_flags_t<ParseFlags...>::value>>;
+			constexpr json_options_t policy_flags =
+			  options::output_flags_t<OutputFlags...>::value;
+
+			if constexpr( json_details::use_buffered_output_v<writable_t> ) {
+				auto buffer = json_details::buffered_output<writable_t>( it );
+				auto out_it = serialization_policy<decltype( buffer ), policy_flags>(
+				  buffer );
+				json_details::reformat_document<ParseState>( json_data, out_it );
+				buffer.flush( );
+			} else {
+				daw_json_ensure( it != nullptr, ErrorReason::NullOutputIterator );
+				auto out_it = serialization_policy<writable_t, policy_flags>( it );
+				json_details::reformat_document<ParseState>( json_data, out_it );
+			}
+			return it;
+		}
+
+		/***
+		 * @brief Rewrite any JSON document with the whitespace of the output
+		 * options.  See json_reformat
+		 */
+		template<typename String, typename WritableType, auto... OutputFlags>
+		daw::rvalue_to_value_t<WritableType>
+		json_reformat( String &&json_data, WritableType &&it,
+		               options::output_flags_t<OutputFlags...> output_flags ) {
+			return json_reformat( DAW_FWD( json_data ), DAW_FWD( it ), output_flags,
+			                      options::parse_flags<> );
+		}
+
+		/***
+		 * @brief Rewrite any JSON document with the whitespace of the output
+		 * options.  See json_reformat
+		 * @return a std::string with the result
+		 */
+		template<typename String, auto... OutputFlags>
+		[[nodiscard]] std::string
+		json_reformat( String &&json_data,
+		               options::output_flags_t<OutputFlags...> output_flags ) {
+			auto result = std::string( );
+			result.reserve( std::size( json_data ) );
+			(void)json_reformat( DAW_FWD( json_data ), result, output_flags );
+			return result;
+		}
+
+		/***
+		 * @brief Remove the insignificant whitespace from any JSON document.  See
+		 * json_reformat
+		 * @param json_data JSON document to minify
+		 * @param it writable output, e.g. a std::string, std::ostream or char *
+		 * @return the output after writing
+		 */
+		template<typename String, typename WritableType>
+		daw::rvalue_to_value_t<WritableType>
+		json_minify( String &&json_data, WritableType &&it ) {
+			return json_reformat( DAW_FWD( json_data ), DAW_FWD( it ),
+			                      options::output_flags<> );
+		}
+
+		/***
+		 * @brief Remove the insignificant whitespace from any JSON document.  See
+		 * json_reformat
+		 * @return a std::string with the result
+		 */
+		template<typename String>
+		[[nodiscard]] std::string json_minify( String &&json_data ) {
+			return json_reformat( DAW_FWD( json_data ), options::output_flags<> );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -80,6 +80,21 @@ namespace daw::json {
 				/// default: No
 				///
 				enum class OutputTrailingComma : unsigned { No, Yes };
+
+				///
+				/// @brief How raw values, e.g. json_raw and json_value members, are
+				/// output
+				///
+				/// default: Verbatim
+				///
+				enum class RawValueFormat : unsigned {
+					/* Copy the JSON text of the value unchanged */
+					Verbatim,
+					/* Rewrite the whitespace of the value to match the
+					   SerializationFormat, e.g. to minify it or to indent it with the
+					   surrounding members */
+					Reformat
+				}; // 1bit
 			} // namespace serialize_options
 		}   // namespace options
 	}     // namespace DAW_JSON_VER
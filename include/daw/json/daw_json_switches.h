@@ -75,6 +75,10 @@
 // Show extra diagnostic information like unmapped members when parsing
 // by defining DAW_JSON_PARSER_DIAGNOSTICS
 
+// Count what the parser does for each mapped class, see
+// <daw/json/daw_json_parser_statistics.h>, by defining
+// DAW_JSON_PARSER_STATISTICS
+
 // DAW_CAN_CONSTANT_EVAL is used to test if we are in a constant expression
 #if defined( DAW_JSON_COMPILER_GCC_COMPAT )
 #define DAW_CAN_CONSTANT_EVAL( ... ) \
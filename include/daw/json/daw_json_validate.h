@@ -0,0 +1,493 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_from_json.h"
+#include "daw_json_exception.h"
+#include "daw_json_link_types.h"
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_parse_name.h"
+#include "impl/daw_json_parse_policy.h"
+#include "impl/daw_json_parse_value.h"
+#include "impl/daw_json_skip.h"
+
+#include <daw/daw_string_view.h>
+
+#include <ciso646>
+#include <cstddef>
+#include <string_view>
+#include <utility>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			template<typename JsonMember, typename ParseState>
+			constexpr void validate_value( ParseState &parse_state );
+
+			/// @brief The length of the UTF-8 sequence starting at first, or 0 if
+			/// it is not a valid, shortest form, encoding of a code point
+			template<typename CharT>
+			[[nodiscard]] constexpr std::size_t
+			utf8_sequence_length( CharT *first, CharT *last ) {
+				auto const byte = [&]( std::ptrdiff_t n ) -> unsigned {
+					return static_cast<unsigned char>( first[n] );
+				};
+				auto const is_continuation = [&]( std::ptrdiff_t n ) {
+					return ( byte( n ) & 0xC0U ) == 0x80U;
+				};
+				auto const avail = last - first;
+				unsigned const lead = byte( 0 );
+				if( lead >= 0xC2U and lead <= 0xDFU ) {
+					return avail >= 2 and is_continuation( 1 ) ? 2U : 0U;
+				}
+				if( lead >= 0xE0U and lead <= 0xEFU ) {
+					if( avail < 3 or not is_continuation( 1 ) or
+					    not is_continuation( 2 ) ) {
+						return 0;
+					}
+					// Overlong encodings and UTF-16 surrogates
+					if( ( lead == 0xE0U and byte( 1 ) < 0xA0U ) or
+					    ( lead == 0xEDU and byte( 1 ) > 0x9FU ) ) {
+						return 0;
+					}
+					return 3;
+				}
+				if( lead >= 0xF0U and lead <= 0xF4U ) {
+					if( avail < 4 or not is_continuation( 1 ) or
+					    not is_continuation( 2 ) or not is_continuation( 3 ) ) {
+						return 0;
+					}
+					// Overlong encodings and code points past 0x10FFFF
+					if( ( lead == 0xF0U and byte( 1 ) < 0x90U ) or
+					    ( lead == 0xF4U and byte( 1 ) > 0x8FU ) ) {
+						return 0;
+					}
+					return 4;
+				}
+				return 0;
+			}
+
+			[[nodiscard]] constexpr bool is_hex_digit( char c ) {
+				return ( c >= '0' and c <= '9' ) or ( c >= 'a' and c <= 'f' ) or
+				       ( c >= 'A' and c <= 'F' );
+			}
+
+			/// @brief Check the escapes and the UTF-8 encoding of the contents of a
+			/// string, str is the range between the quotes
+			template<options::EightBitModes EightBitMode, typename ParseState>
+			constexpr void validate_string_contents( ParseState str ) {
+				auto const error_at = [&]( auto pos, ErrorReason reason ) {
+					str.first = pos;
+					daw_json_error( reason, str );
+				};
+				auto pos = str.first;
+				auto const last = str.last;
+				while( pos < last ) {
+					auto const c = static_cast<unsigned char>( *pos );
+					if( c == '\\' ) {
+						if( last - pos < 2 ) {
+							error_at( pos, ErrorReason::InvalidString );
+						}
+						switch( pos[1] ) {
+						case '"':
+						case '\\':
+						case '/':
+						case 'b':
+						case 'f':
+						case 'n':
+						case 'r':
+						case 't':
+							pos += 2;
+							break;
+						case 'u':
+							if( last - pos < 6 or not is_hex_digit( pos[2] ) or
+							    not is_hex_digit( pos[3] ) or not is_hex_digit( pos[4] ) or
+							    not is_hex_digit( pos[5] ) ) {
+								error_at( pos, ErrorReason::InvalidUTFEscape );
+							}
+							pos += 6;
+							break;
+						default:
+							error_at( pos, ErrorReason::InvalidString );
+						}
+					} else if( c < 0x20U ) {
+						if constexpr( ParseState::exclude_special_escapes( ) ) {
+							error_at( pos, ErrorReason::InvalidString );
+						}
+						++pos;
+					} else if( c < 0x80U ) {
+						++pos;
+					} else {
+						if constexpr( EightBitMode ==
+						              options::EightBitModes::DisallowHigh ) {
+							error_at( pos, ErrorReason::InvalidStringHighASCII );
+						}
+						auto const len = utf8_sequence_length( pos, last );
+						if( len == 0 ) {
+							error_at( pos, ErrorReason::InvalidUTFCodepoint );
+						}
+						pos += static_cast<std::ptrdiff_t>( len );
+					}
+				}
+			}
+
+			template<options::EightBitModes EightBitMode, typename ParseState>
+			constexpr void validate_string( ParseState &parse_state ) {
+				daw_json_ensure( parse_state.is_quotes_checked( ),
+				                 ErrorReason::InvalidString, parse_state );
+				auto const str = skip_string( parse_state );
+				validate_string_contents<EightBitMode>( str );
+				parse_state.trim_left_checked( );
+			}
+
+			template<typename JsonMember, typename ParseState>
+			constexpr void validate_nullable( ParseState &parse_state ) {
+				daw_json_ensure( parse_state.has_more( ),
+				                 ErrorReason::UnexpectedEndOfData, parse_state );
+				if( parse_state.starts_with( "null" ) ) {
+					parse_state.remove_prefix( 4 );
+					daw_json_ensure(
+					  not parse_state.has_more( ) or
+					    parse_policy_details::at_end_of_item( parse_state.front( ) ),
+					  ErrorReason::InvalidLiteral, parse_state );
+					parse_state.trim_left_checked( );
+					return;
+				}
+				validate_value<typename JsonMember::member_type>( parse_state );
+			}
+
+			/// @brief Custom values are parsed, as the FromJsonConverter can reject
+			/// them, e.g. an unknown json_enum name or an out of range
+			/// json_number_decimal.  The result is discarded
+			template<typename JsonMember, typename ParseState>
+			constexpr void validate_custom( ParseState &parse_state ) {
+				if constexpr( JsonMember::custom_json_type ==
+				              options::JsonCustomTypes::String ) {
+					auto str_state = parse_state;
+					validate_string<options::EightBitModes::AllowFull>( str_state );
+				} else if constexpr( JsonMember::custom_json_type ==
+				                     options::JsonCustomTypes::Literal ) {
+					daw_json_ensure( parse_state.has_more( ) and
+					                   parse_state.front( ) != '"',
+					                 ErrorReason::InvalidLiteral, parse_state );
+				}
+				(void)parse_value<JsonMember>(
+				  parse_state, ParseTag<JsonParseTypes::Custom>{ } );
+				parse_state.trim_left_checked( );
+			}
+
+			template<typename JsonElement, typename ParseState>
+			constexpr void validate_array( ParseState &parse_state ) {
+				daw_json_ensure( parse_state.is_opening_bracket_checked( ),
+				                 ErrorReason::InvalidArrayStart, parse_state );
+				parse_state.remove_prefix( );
+				parse_state.trim_left_checked( );
+				if( parse_state.front_checked( ) != ']' ) {
+					while( true ) {
+						validate_value<JsonElement>( parse_state );
+						parse_state.trim_left_checked( );
+						if( parse_state.front_checked( ) != ',' ) {
+							break;
+						}
+						parse_state.remove_prefix( );
+						parse_state.trim_left_checked( );
+					}
+					if( parse_state.front( ) != ']' ) {
+						daw_json_error( missing_token( ']' ), parse_state );
+					}
+				}
+				parse_state.remove_prefix( );
+				parse_state.trim_left_checked( );
+			}
+
+			/// @brief Walk the members of a JSON object, validate_member is called
+			/// with the name of each member and the state at its value and returns
+			/// if it was validated.  Members that were not are skipped, or an error
+			/// when IsExact
+			template<bool IsExact, typename ParseState, typename ValidateMember>
+			constexpr void validate_members( ParseState &parse_state,
+			                                 ValidateMember &&validate_member ) {
+				daw_json_ensure( parse_state.is_opening_brace_checked( ),
+				                 ErrorReason::InvalidClassStart, parse_state );
+				parse_state.remove_prefix( );
+				parse_state.trim_left_checked( );
+				if( parse_state.front_checked( ) != '}' ) {
+					while( true ) {
+						daw_json_ensure( parse_state.is_quotes_checked( ),
+						                 ErrorReason::InvalidMemberName, parse_state );
+						auto const name = parse_name( parse_state );
+						if( not validate_member( name, parse_state ) ) {
+							daw_json_ensure( not IsExact, ErrorReason::UnknownMember,
+							                 parse_state );
+							(void)skip_value( parse_state );
+						}
+						parse_state.trim_left_checked( );
+						if( parse_state.front_checked( ) != ',' ) {
+							break;
+						}
+						parse_state.remove_prefix( );
+						parse_state.trim_left_checked( );
+					}
+					if( parse_state.front( ) != '}' ) {
+						daw_json_error( missing_token( '}' ), parse_state );
+					}
+				}
+				parse_state.remove_prefix( );
+				parse_state.trim_left_checked( );
+			}
+
+			/// @brief Validate a JSON object against a json_class's data contract.
+			/// Contracts that are not a json_member_list, e.g. json_tuple_member_list
+			/// or a submember tagged variant, are checked by parsing them
+			template<typename JsonClass, typename DataContract>
+			struct json_class_validator {
+				template<typename ParseState>
+				static constexpr void validate( ParseState &parse_state ) {
+					(void)parse_value<JsonClass>(
+					  parse_state, ParseTag<JsonClass::expected_type>{ } );
+				}
+			};
+
+			template<typename JsonClass, typename... JsonMembers>
+			struct json_class_validator<JsonClass, json_member_list<JsonMembers...>> {
+				template<typename ParseState>
+				static constexpr void validate( ParseState &parse_state ) {
+					if constexpr( ( JsonMembers::must_be_class_member or ... ) ) {
+						// Members like tagged variants need the rest of the class to be
+						// known, check by parsing
+						(void)parse_value<JsonClass>(
+						  parse_state, ParseTag<JsonClass::expected_type>{ } );
+					} else {
+						using T = typename JsonClass::parse_to_t;
+						bool seen[sizeof...( JsonMembers ) + 1]{ };
+						validate_members<all_json_members_must_exist_v<T, ParseState>>(
+						  parse_state,
+						  [&]( daw::string_view name, ParseState &member_state ) {
+							  return validate_member(
+							    name, member_state, seen,
+							    std::index_sequence_for<JsonMembers...>{ } );
+						  } );
+						check_required( parse_state, seen,
+						                std::index_sequence_for<JsonMembers...>{ } );
+					}
+				}
+
+			private:
+				template<typename JsonMember, typename ParseState>
+				static constexpr void validate_if_named( daw::string_view name,
+				                                         ParseState &parse_state,
+				                                         bool &seen, bool &is_known ) {
+					if( name == JsonMember::name ) {
+						if( not is_known ) {
+							validate_value<without_name<JsonMember>>( parse_state );
+							is_known = true;
+						}
+						seen = true;
+					}
+				}
+
+				template<typename ParseState, std::size_t... Is>
+				static constexpr bool validate_member( daw::string_view name,
+				                                       ParseState &parse_state,
+				                                       bool *seen,
+				                                       std::index_sequence<Is...> ) {
+					bool is_known = false;
+					( validate_if_named<JsonMembers>( name, parse_state, seen[Is],
+					                                  is_known ),
+					  ... );
+					return is_known;
+				}
+
+				template<typename JsonMember, typename ParseState>
+				static constexpr void check_member_seen( ParseState &parse_state,
+				                                         bool seen ) {
+					if constexpr( not is_json_nullable_v<JsonMember> ) {
+						if( not seen ) {
+							daw_json_error( missing_member( std::string_view(
+							                  std::data( JsonMember::name ),
+							                  std::size( JsonMember::name ) ) ),
+							                parse_state );
+						}
+					} else {
+						(void)parse_state;
+						(void)seen;
+					}
+				}
+
+				template<typename ParseState, std::size_t... Is>
+				static constexpr void check_required( ParseState &parse_state,
+				                                      bool const *seen,
+				                                      std::index_sequence<Is...> ) {
+					(void)seen;
+					( check_member_seen<JsonMembers>( parse_state, seen[Is] ), ... );
+				}
+			};
+
+			/// @brief Validate a JSON object of key/value pairs.  Each name is
+			/// checked against the key mapping, as json_key_t would parse it, and
+			/// each value against the element mapping
+			template<typename JsonMember, typename ParseState>
+			constexpr void validate_key_value( ParseState &parse_state ) {
+				daw_json_ensure( parse_state.is_opening_brace_checked( ),
+				                 ErrorReason::InvalidClassStart, parse_state );
+				parse_state.remove_prefix( );
+				parse_state.trim_left_checked( );
+				if( parse_state.front_checked( ) != '}' ) {
+					while( true ) {
+						daw_json_ensure( parse_state.is_quotes_checked( ),
+						                 ErrorReason::InvalidMemberName, parse_state );
+						validate_value<typename JsonMember::json_key_t>( parse_state );
+						daw_json_ensure( parse_state.front_checked( ) == ':',
+						                 ErrorReason::InvalidMemberName, parse_state );
+						parse_state.remove_prefix( );
+						parse_state.trim_left_checked( );
+						validate_value<typename JsonMember::json_element_t>(
+						  parse_state );
+						parse_state.trim_left_checked( );
+						if( parse_state.front_checked( ) != ',' ) {
+							break;
+						}
+						parse_state.remove_prefix( );
+						parse_state.trim_left_checked( );
+					}
+					if( parse_state.front( ) != '}' ) {
+						daw_json_error( missing_token( '}' ), parse_state );
+					}
+				}
+				parse_state.remove_prefix( );
+				parse_state.trim_left_checked( );
+			}
+
+			/***
+			 * @brief Check that the JSON value at parse_state conforms to the
+			 * mapping JsonMember without constructing it.  Numbers, bools and
+			 * timestamps are checked by their parsers as they do not allocate.
+			 * Strings have their escapes and UTF-8 encoding checked, classes their
+			 * member types and required members.  Variants, tuples and sized arrays
+			 * need the values to find their alternatives/positions and are checked
+			 * by parsing them, as are custom values so that their FromJsonConverter
+			 * runs.
+			 */
+			template<typename JsonMember, typename ParseState>
+			constexpr void validate_value( ParseState &parse_state ) {
+				constexpr JsonParseTypes expected_type = JsonMember::expected_type;
+				if constexpr( expected_type == JsonParseTypes::Null ) {
+					validate_nullable<JsonMember>( parse_state );
+				} else if constexpr( expected_type == JsonParseTypes::StringRaw or
+				                     expected_type == JsonParseTypes::StringEscaped ) {
+					validate_string<JsonMember::eight_bit_mode>( parse_state );
+				} else if constexpr( expected_type == JsonParseTypes::Custom ) {
+					validate_custom<JsonMember>( parse_state );
+				} else if constexpr( expected_type == JsonParseTypes::Class ) {
+					using data_contract = typename JsonMember::data_contract;
+					json_class_validator<JsonMember, data_contract>::validate(
+					  parse_state );
+				} else if constexpr( expected_type == JsonParseTypes::Array ) {
+					validate_array<typename JsonMember::json_element_t>( parse_state );
+				} else if constexpr( expected_type == JsonParseTypes::KeyValue ) {
+					validate_key_value<JsonMember>( parse_state );
+				} else if constexpr( expected_type == JsonParseTypes::Unknown ) {
+					(void)skip_value( parse_state );
+					parse_state.trim_left_checked( );
+				} else {
+					(void)parse_value<JsonMember>( parse_state,
+					                               ParseTag<expected_type>{ } );
+					parse_state.trim_left_checked( );
+				}
+			}
+		} // namespace json_details
+
+		/***
+		 * @brief Check that json_data conforms to the mapping of JsonMember, e.g.
+		 * a type with a json_data_contract, without constructing the values.
+		 * Member types, required members, number ranges, string escapes and
+		 * UTF-8 encoding, and timestamp formats are checked.  Custom members,
+		 * e.g. json_enum, are checked by their FromJsonConverter.  The whole
+		 * document must be the value, only whitespace may follow it.
+		 * @tparam JsonMember type or mapping to check the document against
+		 * @param json_data JSON document to check
+		 * @throws daw::json::json_exception describing the first problem found.
+		 * Other exceptions thrown by a FromJsonConverter are passed on
+		 */
+		template<typename JsonMember, typename String, auto... PolicyFlags>
+		constexpr void json_ensure_valid( String &&json_data,
+		                                  options::parse_flags_t<PolicyFlags...> ) {
+			static_assert(
+			  json_details::is_string_view_like_v<String>,
+			  "String type must have a be a contiguous range of Characters" );
+			static_assert(
+			  json_details::has_json_deduced_type_v<JsonMember>,
+			  "Missing specialization of daw::json::json_data_contract for class "
+			  "mapping or specialization of daw::json::json_link_basic_type_map" );
+			daw_json_ensure( std::data( json_data ) != nullptr,
+			                 ErrorReason::EmptyJSONDocument );
+			daw_json_ensure( std::size( json_data ) != 0,
+			                 ErrorReason::EmptyJSONDocument );
+
+			using json_member = json_details::json_deduced_type<JsonMember>;
+			using ParseState = TryDefaultParsePolicy<
+			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>>;
+			static_assert( not ParseState::is_unchecked_input,
+			               "Validation requires checked input" );
+
+			auto parse_state =
+			  ParseState( std::data( json_data ), daw::data_end( json_data ) );
+			parse_state.trim_left_checked( );
+			json_details::validate_value<json_member>( parse_state );
+			parse_state.trim_left_checked( );
+			daw_json_ensure( parse_state.empty( ), ErrorReason::InvalidEndOfValue,
+			                 parse_state );
+		}
+
+		/***
+		 * @brief Check that json_data conforms to the mapping of JsonMember
+		 * without constructing the values.  See json_ensure_valid
+		 * @throws daw::json::json_exception describing the first problem found
+		 */
+		template<typename JsonMember, typename String>
+		constexpr void json_ensure_valid( String &&json_data ) {
+			json_ensure_valid<JsonMember>( DAW_FWD( json_data ),
+			                               options::parse_flags<> );
+		}
+
+#if defined( DAW_USE_EXCEPTIONS )
+		/***
+		 * @brief Does json_data conform to the mapping of JsonMember.  The values
+		 * are not constructed.  See json_ensure_valid for what is checked
+		 * @tparam JsonMember type or mapping to check the document against
+		 * @param json_data JSON document to check
+		 * @return true when json_data could be parsed to JsonMember
+		 */
+		template<typename JsonMember, typename String, auto... PolicyFlags>
+		[[nodiscard]] bool
+		json_validate( String &&json_data,
+		               options::parse_flags_t<PolicyFlags...> flags ) {
+			try {
+				json_ensure_valid<JsonMember>( DAW_FWD( json_data ), flags );
+			} catch( json_exception const & ) { return false; }
+			return true;
+		}
+
+		/***
+		 * @brief Does json_data conform to the mapping of JsonMember.  The values
+		 * are not constructed.  See json_ensure_valid for what is checked
+		 * @tparam JsonMember type or mapping to check the document against
+		 * @param json_data JSON document to check
+		 * @return true when json_data could be parsed to JsonMember
+		 */
+		template<typename JsonMember, typename String>
+		[[nodiscard]] bool json_validate( String &&json_data ) {
+			return json_validate<JsonMember>( DAW_FWD( json_data ),
+			                                  options::parse_flags<> );
+		}
+#endif
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -76,6 +76,50 @@ namespace daw::json {
 			return result;
 		}
 
+		template<typename JsonClass, typename Value, auto... PolicyFlags>
+		constexpr std::size_t
+		to_json_size( Value const &value,
+		              options::output_flags_t<PolicyFlags...> flgs ) {
+			return to_json<JsonClass>( value, output_size_counter{ }, flgs ).size;
+		}
+
+		template<typename JsonClass, typename Result, typename Value,
+		         auto... PolicyFlags>
+		Result to_json_exact( Value const &value,
+		                      options::output_flags_t<PolicyFlags...> flgs ) {
+			auto const size = to_json_size<JsonClass>( value, flgs );
+			auto result = Result( );
+			result.resize( size );
+			auto *const last = to_json<JsonClass>( value, std::data( result ), flgs );
+			daw_json_ensure( last == std::data( result ) + size,
+			                 ErrorReason::OutputError );
+			return result;
+		}
+
+		namespace json_details {
+			/// @brief Write an element of an array, starting on a new line when the
+			/// output is pretty
+			template<typename JsonElement, typename OutputPolicy, typename Value>
+			constexpr void to_json_array_element( OutputPolicy &out_it,
+			                                      Value const &v ) {
+				using JsonMember = typename std::conditional_t<
+				  std::is_same_v<JsonElement, use_default>,
+				  json_details::ident_trait<json_details::json_deduced_type, Value>,
+				  json_details::ident_trait<json_details::json_deduced_type,
+				                            JsonElement>>::type;
+
+				static_assert(
+				  not std::is_same_v<
+				    JsonMember,
+				    missing_json_data_contract_for_or_unknown_type<JsonElement>>,
+				  "Unable to detect unnamed mapping" );
+				out_it.next_member( );
+
+				out_it = json_details::member_to_string( template_arg<JsonMember>,
+				                                         out_it, v );
+			}
+		} // namespace json_details
+
 		template<typename JsonElement, typename Container, typename WritableType,
 		         auto... PolicyFlags,
 		         std::enable_if_t<concepts::is_writable_output_type_v<
@@ -117,26 +161,7 @@ namespace daw::json {
 			auto last = std::end( c );
 			bool const has_elements = first != last;
 			while( first != last ) {
-				(void)[&out_it]( auto &&v ) {
-					using v_type = DAW_TYPEOF( v );
-					using JsonMember = typename std::conditional_t<
-					  std::is_same_v<JsonElement, use_default>,
-					  json_details::ident_trait<json_details::json_deduced_type, v_type>,
-					  json_details::ident_trait<json_details::json_deduced_type,
-					                            JsonElement>>::type;
-
-					static_assert(
-					  not std::is_same_v<
-					    JsonMember,
-					    missing_json_data_contract_for_or_unknown_type<JsonElement>>,
-					  "Unable to detect unnamed mapping" );
-					// static_assert( not std::is_same_v<JsonElement, JsonMember> );
-					out_it.next_member( );
-
-					out_it = json_details::member_to_string( template_arg<JsonMember>,
-					                                         out_it, v );
-				}
-				( *first );
+				json_details::to_json_array_element<JsonElement>( out_it, *first );
 				++first;
 				if( first != last ) {
 					out_it.put( ',' );
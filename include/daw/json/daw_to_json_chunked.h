@@ -0,0 +1,153 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_to_json.h"
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_serialize_policy.h"
+
+#include <daw/daw_string_view.h>
+#include <daw/daw_traits.h>
+
+#include <algorithm>
+#include <ciso646>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <type_traits>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * @brief Serialize a container to a JSON array on demand, in chunks.
+		 * Each call to next_chunk( ) serializes only as many elements as needed
+		 * to fill a chunk, so the memory used is bounded by the chunk size plus
+		 * the size of one element and the first chunk is ready as soon as the
+		 * first elements are.  Joining the chunks gives the same result as
+		 * to_json_array.  The container must outlive the chunker.  See
+		 * to_json_array_chunks
+		 * @tparam JsonElement mapping of the elements, use_default to deduce it
+		 * @tparam Container type of container to serialize
+		 * @tparam PolicyFlags output options
+		 */
+		template<typename JsonElement, typename Container,
+		         json_options_t PolicyFlags =
+		           json_details::serialization::default_policy_flag>
+		class json_array_chunker {
+			static_assert(
+			  traits::is_container_like_v<Container>,
+			  "Supplied container must support begin( )/end( )" );
+			using iterator_t =
+			  DAW_TYPEOF( std::begin( std::declval<Container const &>( ) ) );
+			using policy_t = serialization_policy<std::string, PolicyFlags>;
+
+			enum class state_t { Start, Elements, Done };
+
+			iterator_t m_first;
+			iterator_t m_last;
+			std::size_t m_chunk_size;
+			std::size_t m_consumed = 0;
+			std::string m_buffer{ };
+			policy_t m_out_it;
+			state_t m_state = state_t::Start;
+
+			/// @brief Serialize the next part of the array to the buffer
+			void serialize_next( ) {
+				switch( m_state ) {
+				case state_t::Start:
+					m_out_it.put( '[' );
+					if( m_first == m_last ) {
+						m_out_it.put( ']' );
+						m_state = state_t::Done;
+						return;
+					}
+					m_out_it.add_indent( );
+					m_state = state_t::Elements;
+					return;
+				case state_t::Elements:
+					json_details::to_json_array_element<JsonElement>( m_out_it,
+					                                                  *m_first );
+					++m_first;
+					if( m_first != m_last ) {
+						m_out_it.put( ',' );
+						return;
+					}
+					m_out_it.del_indent( );
+					m_out_it.output_newline( );
+					m_out_it.put( ']' );
+					m_state = state_t::Done;
+					return;
+				case state_t::Done:
+					return;
+				}
+			}
+
+		public:
+			/// @param c Container to serialize
+			/// @param chunk_size size of the chunks returned, must not be 0
+			explicit json_array_chunker( Container const &c,
+			                             std::size_t chunk_size = 65536 )
+			  : m_first( std::begin( c ) )
+			  , m_last( std::end( c ) )
+			  , m_chunk_size( chunk_size )
+			  , m_out_it( m_buffer ) {
+				daw_json_ensure( chunk_size > 0, ErrorReason::OutputError );
+				m_buffer.reserve( chunk_size );
+			}
+
+			// m_out_it refers to m_buffer
+			json_array_chunker( json_array_chunker const & ) = delete;
+			json_array_chunker &operator=( json_array_chunker const & ) = delete;
+
+			/// @brief Are there no more chunks
+			[[nodiscard]] bool done( ) const {
+				return m_state == state_t::Done and m_consumed == m_buffer.size( );
+			}
+
+			/***
+			 * @brief Serialize and return the next chunk of the array.  Every chunk
+			 * but the last is chunk_size long
+			 * @return a view of the chunk, valid until the next call, empty when
+			 * done
+			 * @throws daw::json::json_exception thrown by serializing an element
+			 */
+			[[nodiscard]] daw::string_view next_chunk( ) {
+				m_buffer.erase( 0, m_consumed );
+				m_consumed = 0;
+				while( m_buffer.size( ) < m_chunk_size and
+				       m_state != state_t::Done ) {
+					serialize_next( );
+				}
+				m_consumed = ( std::min )( m_chunk_size, m_buffer.size( ) );
+				return daw::string_view( m_buffer.data( ), m_consumed );
+			}
+		};
+
+		/***
+		 * @brief Create a json_array_chunker to serialize a container to a JSON
+		 * array in chunks of chunk_size
+		 * @tparam JsonElement mapping of the elements, defaults to deducing it
+		 * @param c Container to serialize, it must outlive the result
+		 * @param chunk_size size of the chunks, must not be 0
+		 */
+		template<typename JsonElement = use_default, typename Container,
+		         auto... PolicyFlags>
+		[[nodiscard]] json_array_chunker<
+		  JsonElement, Container, options::output_flags_t<PolicyFlags...>::value>
+		to_json_array_chunks( Container const &c, std::size_t chunk_size = 65536,
+		                      options::output_flags_t<PolicyFlags...> =
+		                        options::output_flags<> ) {
+			return json_array_chunker<JsonElement, Container,
+			                          options::output_flags_t<PolicyFlags...>::value>(
+			  c, chunk_size );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -75,6 +75,37 @@ namespace daw::json {
 		inline std::string to_json( Value const &value,
 		                            options::output_flags_t<PolicyFlags...> );
 
+		/// @brief The exact number of characters to_json will output for value.
+		/// It serializes value without storing the result
+		/// @tparam JsonClass Type that has json_parser_description and to_json_data
+		/// function overloads
+		/// @param value  value to serialize
+		/// @return size of the JSON representation of value
+		template<typename JsonClass = use_default, typename Value,
+		         auto... PolicyFlags>
+		constexpr std::size_t
+		to_json_size( Value const &value,
+		              options::output_flags_t<PolicyFlags...> =
+		                options::output_flags<> );
+
+		/// @brief Serialize a value to JSON with a single allocation of the
+		/// exact size.  The size is found by first serializing to an
+		/// output_size_counter, the second pass writes to the result without
+		/// any growth checks.  The size pass is a full serialization, numbers
+		/// are formatted and strings escaped twice, so this trades CPU time for
+		/// no excess capacity and no growth copies.  It is not faster than
+		/// to_json, see canada_output_test for a double heavy comparison
+		/// @tparam JsonClass Type that has json_parser_description and to_json_data
+		/// function overloads
+		/// @tparam Result A contiguous resizable range of char, e.g std::string
+		/// @param value  value to serialize
+		/// @return Result with JSON representation of value
+		template<typename JsonClass = use_default, typename Result = std::string,
+		         typename Value, auto... PolicyFlags>
+		Result to_json_exact( Value const &value,
+		                      options::output_flags_t<PolicyFlags...> =
+		                        options::output_flags<> );
+
 		namespace json_details {
 			/// @brief Tag type to indicate that the element of a Container is not
 			/// being specified.  This is the default.
@@ -0,0 +1,200 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "concepts/daw_writable_output.h"
+#include "daw_to_json.h"
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_serialize_policy.h"
+
+#include <daw/daw_traits.h>
+
+#include <algorithm>
+#include <ciso646>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief Joins every thread that was started when it goes out of
+			/// scope, so that no thread outlives the state it references
+			struct thread_joiner {
+				std::vector<std::thread> threads{ };
+
+				thread_joiner( ) = default;
+				thread_joiner( thread_joiner const & ) = delete;
+				thread_joiner &operator=( thread_joiner const & ) = delete;
+
+				~thread_joiner( ) {
+					for( auto &t : threads ) {
+						if( t.joinable( ) ) {
+							t.join( );
+						}
+					}
+				}
+			};
+
+			/***
+			 * @brief Serialize the elements [first, last) of an array to buffer as
+			 * to_json_array would have, including the ',' after each element that is
+			 * not the last of the array
+			 */
+			template<typename JsonElement, json_options_t PolicyFlags,
+			         typename Iterator>
+			void to_json_array_chunk( std::string &buffer, Iterator first,
+			                          Iterator last, bool is_last_chunk ) {
+				auto out_it = serialization_policy<std::string, PolicyFlags>( buffer );
+				// The elements are inside of the array
+				out_it.add_indent( );
+				while( first != last ) {
+					to_json_array_element<JsonElement>( out_it, *first );
+					++first;
+					if( first != last or not is_last_chunk ) {
+						out_it.put( ',' );
+					}
+				}
+			}
+		} // namespace json_details
+
+		/***
+		 * @brief Serialize a container to JSON with several threads.  The
+		 * container is split into contiguous chunks that are serialized into a
+		 * buffer per thread, then copied to the output in order.  The result is
+		 * the same as to_json_array.  Small containers are serialized on the
+		 * calling thread, as are the chunks of any thread that cannot be started
+		 * @tparam JsonElement mapping of the elements, defaults to deducing it
+		 * @param c Container, with random access iterators, to serialize
+		 * @param it writable output to write the array to
+		 * @param thread_count number of threads to use, 0 for the number of
+		 * hardware threads
+		 * @return it after writing
+		 * @throws daw::json::json_exception thrown by serializing any element
+		 */
+		template<typename JsonElement = use_default, typename Container,
+		         typename WritableType, auto... PolicyFlags,
+		         std::enable_if_t<concepts::is_writable_output_type_v<
+		                            daw::remove_cvref_t<WritableType>>,
+		                          std::nullptr_t> = nullptr>
+		daw::rvalue_to_value_t<WritableType> to_json_array_parallel(
+		  Container const &c, WritableType &&it,
+		  options::output_flags_t<PolicyFlags...> flgs = options::output_flags<>,
+		  std::size_t thread_count = 0 ) {
+			using iterator_t = DAW_TYPEOF( std::begin( c ) );
+			static_assert(
+			  std::is_base_of_v<
+			    std::random_access_iterator_tag,
+			    typename std::iterator_traits<iterator_t>::iterator_category>,
+			  "Supplied container must have random access iterators" );
+			using writable_t = daw::remove_cvref_t<WritableType>;
+			static_assert( not is_serialization_policy_v<writable_t>,
+			               "Output type must not be a serialization_policy" );
+			constexpr json_options_t policy_flags =
+			  options::output_flags_t<PolicyFlags...>::value;
+
+			if( thread_count == 0 ) {
+				thread_count =
+				  ( std::max )( std::thread::hardware_concurrency( ), 1U );
+			}
+			auto const first = std::begin( c );
+			auto const size =
+			  static_cast<std::size_t>( std::distance( first, std::end( c ) ) );
+			std::size_t const chunk_count = ( std::min )( thread_count, size );
+			if( chunk_count <= 1 ) {
+				return to_json_array<JsonElement>( c, DAW_FWD( it ), flgs );
+			}
+			if constexpr( std::is_pointer_v<writable_t> ) {
+				daw_json_ensure( it != nullptr, ErrorReason::InvalidNull );
+			}
+
+			auto const chunk_first = [&]( std::size_t n ) {
+				auto const pos = size * n / chunk_count;
+				return std::next( first, static_cast<std::ptrdiff_t>( pos ) );
+			};
+			auto buffers = std::vector<std::string>( chunk_count );
+#if defined( DAW_USE_EXCEPTIONS )
+			auto errors = std::vector<std::exception_ptr>( chunk_count );
+#endif
+			auto const serialize_chunk = [&]( std::size_t n ) {
+#if defined( DAW_USE_EXCEPTIONS )
+				try {
+#endif
+					json_details::to_json_array_chunk<JsonElement, policy_flags>(
+					  buffers[n], chunk_first( n ), chunk_first( n + 1 ),
+					  n + 1 == chunk_count );
+#if defined( DAW_USE_EXCEPTIONS )
+				} catch( ... ) { errors[n] = std::current_exception( ); }
+#endif
+			};
+			{
+				auto joiner = json_details::thread_joiner( );
+				joiner.threads.reserve( chunk_count - 1 );
+				std::size_t started = 1;
+				for( ; started < chunk_count; ++started ) {
+#if defined( DAW_USE_EXCEPTIONS )
+					try {
+#endif
+						joiner.threads.emplace_back( serialize_chunk, started );
+#if defined( DAW_USE_EXCEPTIONS )
+					} catch( std::system_error const & ) {
+						// No more threads can be started, the calling thread
+						// serializes the rest
+						break;
+					}
+#endif
+				}
+				serialize_chunk( 0 );
+				for( std::size_t n = started; n < chunk_count; ++n ) {
+					serialize_chunk( n );
+				}
+			}
+#if defined( DAW_USE_EXCEPTIONS )
+			for( auto const &error : errors ) {
+				if( error ) {
+					std::rethrow_exception( error );
+				}
+			}
+#endif
+
+			auto out_it = serialization_policy<writable_t, policy_flags>( it );
+			out_it.put( '[' );
+			for( auto const &buffer : buffers ) {
+				out_it.write( buffer );
+			}
+			out_it.output_newline( );
+			out_it.put( ']' );
+			return it;
+		}
+
+		/***
+		 * @brief Serialize a container to JSON with several threads.  See
+		 * to_json_array_parallel
+		 * @return A std::string containing the serialized elements of c
+		 */
+		template<typename JsonElement = use_default, typename Container,
+		         auto... PolicyFlags>
+		std::string to_json_array_parallel(
+		  Container const &c,
+		  options::output_flags_t<PolicyFlags...> flgs = options::output_flags<>,
+		  std::size_t thread_count = 0 ) {
+			std::string result{ };
+			(void)to_json_array_parallel<JsonElement>( c, result, flgs,
+			                                           thread_count );
+			return result;
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -57,6 +57,26 @@ namespace daw::json {
 					std::terminate( );
 #ifdef DAW_USE_EXCEPTIONS
 				}
+#endif
+			}
+
+			/// @brief Invoke func and, when a json_exception escapes it, let
+			/// add_context record where in the document it happened before it
+			/// continues to propagate.  Nothing is done unless there is an error.
+			/// Used when parsing with options::ErrorContext::yes
+			template<typename Func, typename AddContext>
+			DAW_ATTRIB_INLINE inline decltype( auto )
+			invoke_with_error_context( Func &&func, AddContext &&add_context ) {
+#ifdef DAW_USE_EXCEPTIONS
+				try {
+					return DAW_FWD( func )( );
+				} catch( json_exception &jex ) {
+					DAW_FWD( add_context )( jex );
+					throw;
+				}
+#else
+				(void)add_context;
+				return DAW_FWD( func )( );
 #endif
 			}
 		} // namespace json_details
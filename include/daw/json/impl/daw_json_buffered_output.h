@@ -0,0 +1,128 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "../concepts/daw_writable_output.h"
+
+#include <daw/daw_string_view.h>
+
+#include <ciso646>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/***
+			 * @brief Collects many small writes and passes them to the output in
+			 * blocks.  Writes larger than the buffer go directly to the output.
+			 * flush( ) must be called when done
+			 * @tparam WritableType output type with a writable_output_trait
+			 * @tparam BufferSize size of the buffer in chars
+			 */
+			template<typename WritableType, std::size_t BufferSize = 4096>
+			class buffered_output {
+				WritableType *m_writable;
+				std::size_t m_size = 0;
+				std::size_t m_passed = 0;
+				char m_buffer[BufferSize];
+
+			public:
+				explicit buffered_output( WritableType &writable )
+				  : m_writable( std::addressof( writable ) ) {}
+
+				buffered_output( buffered_output const & ) = delete;
+				buffered_output &operator=( buffered_output const & ) = delete;
+
+				inline void flush( ) {
+					if( m_size > 0 ) {
+						write_output( *m_writable, daw::string_view( m_buffer, m_size ) );
+						m_passed += m_size;
+						m_size = 0;
+					}
+				}
+
+				/// @brief The number of chars written so far, passed to the output
+				/// or buffered
+				[[nodiscard]] inline std::size_t position( ) const {
+					return m_passed + m_size;
+				}
+
+				/// @brief Drop what was written after pos, a previous position( ).
+				/// @return false when some of it was already passed to the output,
+				/// only the buffered part is dropped then
+				inline bool discard_after( std::size_t pos ) {
+					if( pos < m_passed ) {
+						m_size = 0;
+						return false;
+					}
+					m_size = pos - m_passed;
+					return true;
+				}
+
+				inline void write( daw::string_view sv ) {
+					if( sv.size( ) > BufferSize - m_size ) {
+						flush( );
+						if( sv.size( ) >= BufferSize ) {
+							write_output( *m_writable, sv );
+							m_passed += sv.size( );
+							return;
+						}
+					}
+					if( not sv.empty( ) ) {
+						std::memcpy( m_buffer + m_size, sv.data( ), sv.size( ) );
+						m_size += sv.size( );
+					}
+				}
+
+				inline void put( char c ) {
+					if( m_size == BufferSize ) {
+						flush( );
+					}
+					m_buffer[m_size++] = c;
+				}
+			};
+
+			/// @brief Outputs that are a memcpy away from their storage are written
+			/// to directly, the rest go through a buffered_output
+			template<typename WritableType>
+			inline constexpr bool use_buffered_output_v =
+			  not std::is_pointer_v<WritableType> or
+			  std::is_same_v<WritableType, std::FILE *>;
+		} // namespace json_details
+
+		namespace concepts {
+			/// @brief Specialization for buffered_output
+			template<typename WritableType, std::size_t BufferSize>
+			struct writable_output_trait<
+			  json_details::buffered_output<WritableType, BufferSize>>
+			  : std::true_type {
+				using output_t =
+				  json_details::buffered_output<WritableType, BufferSize>;
+
+				template<typename... StringViews>
+				static inline void write( output_t &out, StringViews const &...svs ) {
+					static_assert( sizeof...( StringViews ) > 0 );
+					( out.write( daw::string_view( std::data( svs ), std::size( svs ) ) ),
+					  ... );
+				}
+
+				static inline void put( output_t &out, char c ) {
+					out.put( c );
+				}
+			};
+		} // namespace concepts
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -12,6 +12,7 @@
 
 #include "../concepts/daw_nullable_value.h"
 #include "../daw_json_default_constuctor_fwd.h"
+#include "../daw_json_parser_statistics.h"
 #include "daw_json_assert.h"
 
 #include <daw/cpp_17.h>
@@ -135,7 +136,19 @@ namespace daw::json {
 					auto result = std::vector<T, Alloc>( alloc );
 					// Lets use a WAG and go for a 4k page size
 					result.reserve( reserve_amount );
+#if defined( DAW_JSON_PARSER_STATISTICS )
+					std::size_t reallocations = 0;
+					for( ; first != last; ++first ) {
+						auto const old_capacity = result.capacity( );
+						result.push_back( *first );
+						reallocations += result.capacity( ) != old_capacity ? 1U : 0U;
+					}
+					json_details::count_parser_statistic<
+					  json_details::parser_statistic::container_reallocations>(
+					  reallocations );
+#else
 					result.assign( first, last );
+#endif
 					return result;
 				}
 			}
@@ -171,6 +184,19 @@ namespace daw::json {
 			}
 		};
 
+		/***
+		 * When true and the default constructor is used, json_key_value counts
+		 * the members of the JSON object first, calls reserve( count ) on a
+		 * default constructed Container and then inserts each member.  This costs
+		 * an extra pass over the object and is worth it for hash tables, e.g. a
+		 * std::unordered_map, that are large enough that growing one element at a
+		 * time means repeated rehashing.  It is opt-in as small objects are
+		 * slower to scan twice than to rehash
+		 * @tparam Container The container type of the json_key_value
+		 */
+		template<typename Container>
+		inline constexpr bool presize_key_value_v = false;
+
 		/// @brief Default constructor for readable nullable types.
 		template<typename T>
 		struct nullable_constructor<
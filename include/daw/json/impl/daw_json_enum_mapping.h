@@ -0,0 +1,386 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "daw_json_assert.h"
+#include "daw_json_traits.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/daw_string_view.h>
+
+#include <array>
+#include <ciso646>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief A single mapping between an enumerator and its JSON string
+		/// @tparam Enum enum type being mapped
+		template<typename Enum>
+		struct json_enum_entry {
+			Enum value;
+			std::string_view name;
+		};
+
+		/***
+		 * @brief Customization point for the default name table used by
+		 * json_enum.  Specialize with a static constexpr array named values of
+		 * json_enum_entry<Enum>, e.g.
+		 * static constexpr json_enum_entry<Colours> values[] = {
+		 *   { Colours::red, "red" }, { Colours::green, "green" } };
+		 * Any type with a suitable static values member can be passed to json_enum
+		 * in its place.  Names cannot contain characters that require escaping.
+		 * When an enumerator is listed more than once, the first name is used for
+		 * serialization and all of them are accepted when parsing.
+		 * @tparam Enum enum type being mapped
+		 */
+		template<typename Enum>
+		struct json_enum_names;
+
+		namespace json_details {
+			inline constexpr std::size_t enum_npos =
+			  ( std::numeric_limits<std::size_t>::max )( );
+
+			template<typename EnumNames>
+			inline constexpr std::size_t enum_names_size =
+			  std::size( EnumNames::values );
+
+			template<typename EnumNames>
+			using enum_names_enum_t =
+			  std::remove_cv_t<decltype( EnumNames::values[0].value )>;
+
+			template<typename EnumNames>
+			using enum_underlying_t =
+			  std::underlying_type_t<enum_names_enum_t<EnumNames>>;
+
+			template<typename EnumNames>
+			[[nodiscard]] constexpr enum_underlying_t<EnumNames>
+			enum_value_at( std::size_t idx ) {
+				return static_cast<enum_underlying_t<EnumNames>>(
+				  EnumNames::values[idx].value );
+			}
+
+			/// Offset of v from min_value.  Well defined for signed types too, as
+			/// the conversion to unsigned is modular
+			template<typename Underlying>
+			[[nodiscard]] constexpr std::uintmax_t
+			enum_value_offset( Underlying v, Underlying min_value ) {
+				return static_cast<std::uintmax_t>( v ) -
+				       static_cast<std::uintmax_t>( min_value );
+			}
+
+			[[nodiscard]] constexpr bool enum_name_less( std::string_view lhs,
+			                                             std::string_view rhs ) {
+				if( lhs.size( ) != rhs.size( ) ) {
+					return lhs.size( ) < rhs.size( );
+				}
+				return lhs.compare( rhs ) < 0;
+			}
+
+			template<typename EnumNames>
+			[[nodiscard]] constexpr bool enum_names_are_valid( ) {
+				for( auto const &entry : EnumNames::values ) {
+					for( char c : entry.name ) {
+						if( c == '"' or c == '\\' or
+						    static_cast<unsigned char>( c ) < 0x20U ) {
+							return false;
+						}
+					}
+				}
+				return true;
+			}
+
+			template<typename EnumNames>
+			[[nodiscard]] constexpr std::size_t enum_max_name_length( ) {
+				std::size_t result = 0;
+				for( auto const &entry : EnumNames::values ) {
+					if( entry.name.size( ) > result ) {
+						result = entry.name.size( );
+					}
+				}
+				return result;
+			}
+
+			/// Indices into EnumNames::values, ordered by name length and then by
+			/// name
+			template<typename EnumNames>
+			[[nodiscard]] constexpr std::array<std::size_t,
+			                                   enum_names_size<EnumNames>>
+			enum_make_by_name( ) {
+				constexpr std::size_t size = enum_names_size<EnumNames>;
+				auto result = std::array<std::size_t, size>{ };
+				for( std::size_t n = 0; n < size; ++n ) {
+					result[n] = n;
+				}
+				// Insertion sort, as std::sort is not constexpr in C++17
+				for( std::size_t n = 1; n < size; ++n ) {
+					std::size_t const cur = result[n];
+					std::size_t pos = n;
+					while( pos > 0 and
+					       enum_name_less( EnumNames::values[cur].name,
+					                       EnumNames::values[result[pos - 1]].name ) ) {
+						result[pos] = result[pos - 1];
+						--pos;
+					}
+					result[pos] = cur;
+				}
+				return result;
+			}
+
+			template<typename EnumNames, std::size_t N>
+			[[nodiscard]] constexpr bool
+			enum_names_are_unique( std::array<std::size_t, N> const &by_name ) {
+				for( std::size_t n = 1; n < N; ++n ) {
+					if( EnumNames::values[by_name[n - 1]].name ==
+					    EnumNames::values[by_name[n]].name ) {
+						return false;
+					}
+				}
+				return true;
+			}
+
+			/// result[len] is the first position in by_name with a name of at least
+			/// len characters
+			template<typename EnumNames, std::size_t MaxLength, std::size_t N>
+			[[nodiscard]] constexpr std::array<std::size_t, MaxLength + 2>
+			enum_make_length_first( std::array<std::size_t, N> const &by_name ) {
+				auto result = std::array<std::size_t, MaxLength + 2>{ };
+				std::size_t pos = 0;
+				for( std::size_t len = 0; len <= MaxLength + 1; ++len ) {
+					while( pos < N and EnumNames::values[by_name[pos]].name.size( ) < len ) {
+						++pos;
+					}
+					result[len] = pos;
+				}
+				return result;
+			}
+
+			template<typename EnumNames>
+			[[nodiscard]] constexpr enum_underlying_t<EnumNames> enum_min_value( ) {
+				auto result = enum_value_at<EnumNames>( 0 );
+				for( std::size_t n = 1; n < enum_names_size<EnumNames>; ++n ) {
+					if( enum_value_at<EnumNames>( n ) < result ) {
+						result = enum_value_at<EnumNames>( n );
+					}
+				}
+				return result;
+			}
+
+			template<typename EnumNames>
+			[[nodiscard]] constexpr enum_underlying_t<EnumNames> enum_max_value( ) {
+				auto result = enum_value_at<EnumNames>( 0 );
+				for( std::size_t n = 1; n < enum_names_size<EnumNames>; ++n ) {
+					if( enum_value_at<EnumNames>( n ) > result ) {
+						result = enum_value_at<EnumNames>( n );
+					}
+				}
+				return result;
+			}
+
+			/// Dense: indexed by value - min_value, holes are enum_npos.  Sparse:
+			/// indices into EnumNames::values stably sorted by value.  Either way the
+			/// first listed entry for a value wins
+			template<typename EnumNames, bool IsDense, std::size_t IndexSize>
+			[[nodiscard]] constexpr std::array<std::size_t, IndexSize>
+			enum_make_by_value( ) {
+				constexpr std::size_t size = enum_names_size<EnumNames>;
+				auto result = std::array<std::size_t, IndexSize>{ };
+				if constexpr( IsDense ) {
+					constexpr auto min_value = enum_min_value<EnumNames>( );
+					for( auto &idx : result ) {
+						idx = enum_npos;
+					}
+					for( std::size_t n = size; n > 0; --n ) {
+						result[static_cast<std::size_t>( enum_value_offset(
+						  enum_value_at<EnumNames>( n - 1 ), min_value ) )] = n - 1;
+					}
+				} else {
+					for( std::size_t n = 0; n < size; ++n ) {
+						result[n] = n;
+					}
+					for( std::size_t n = 1; n < size; ++n ) {
+						std::size_t const cur = result[n];
+						std::size_t pos = n;
+						while( pos > 0 and enum_value_at<EnumNames>( cur ) <
+						                     enum_value_at<EnumNames>( result[pos - 1] ) ) {
+							result[pos] = result[pos - 1];
+							--pos;
+						}
+						result[pos] = cur;
+					}
+				}
+				return result;
+			}
+
+			/***
+			 * Lookup tables for an enum/string mapping, built at compile time.
+			 * Parsing buckets the names by length and binary searches within the
+			 * bucket, so a length mismatch costs nothing and there is no hashing.
+			 * Serializing uses a direct index table when the enumerator values are
+			 * dense and a binary search of the sorted values otherwise.
+			 */
+			template<typename Enum, typename EnumNames>
+			struct enum_name_table {
+				static_assert( std::is_enum_v<Enum>,
+				               "json_enum requires an enum type" );
+				static_assert( std::is_same_v<Enum, enum_names_enum_t<EnumNames>>,
+				               "Enum name mapping must be for the same enum type" );
+				using underlying_t = std::underlying_type_t<Enum>;
+
+				static constexpr std::size_t size = enum_names_size<EnumNames>;
+				static_assert( size > 0, "Enum name mapping cannot be empty" );
+				static_assert( enum_names_are_valid<EnumNames>( ),
+				               "Enum names cannot contain characters that require "
+				               "escaping" );
+
+				static constexpr std::size_t max_name_length =
+				  enum_max_name_length<EnumNames>( );
+
+				static constexpr std::array<std::size_t, size> by_name =
+				  enum_make_by_name<EnumNames>( );
+				static_assert( enum_names_are_unique<EnumNames>( by_name ),
+				               "Enum names must be unique within a mapping" );
+
+				/// The names of length len are in
+				/// by_name[length_first[len], length_first[len + 1])
+				static constexpr std::array<std::size_t, max_name_length + 2>
+				  length_first =
+				    enum_make_length_first<EnumNames, max_name_length>( by_name );
+
+				static constexpr underlying_t min_value = enum_min_value<EnumNames>( );
+				static constexpr std::uintmax_t value_span =
+				  enum_value_offset( enum_max_value<EnumNames>( ), min_value );
+				/// When the enumerators are close together, serialize with a direct
+				/// index instead of searching
+				static constexpr bool is_dense = value_span <= 2U * size + 8U;
+				static constexpr std::size_t index_size =
+				  is_dense ? static_cast<std::size_t>( value_span ) + 1U : size;
+
+				static constexpr std::array<std::size_t, index_size> by_value =
+				  enum_make_by_value<EnumNames, is_dense, index_size>( );
+
+				/// @brief Find the entry matching name
+				/// @return index into EnumNames::values or enum_npos
+				[[nodiscard]] static constexpr std::size_t
+				find_name( std::string_view name ) {
+					if( name.size( ) > max_name_length ) {
+						return enum_npos;
+					}
+					std::size_t first = length_first[name.size( )];
+					std::size_t last = length_first[name.size( ) + 1];
+					while( first < last ) {
+						std::size_t const mid = first + ( last - first ) / 2;
+						int const cmp = EnumNames::values[by_name[mid]].name.compare( name );
+						if( cmp == 0 ) {
+							return by_name[mid];
+						}
+						if( cmp < 0 ) {
+							first = mid + 1;
+						} else {
+							last = mid;
+						}
+					}
+					return enum_npos;
+				}
+
+				/// @brief Find the first entry matching value
+				/// @return index into EnumNames::values or enum_npos
+				[[nodiscard]] static constexpr std::size_t find_value( Enum value ) {
+					auto const v = static_cast<underlying_t>( value );
+					if constexpr( is_dense ) {
+						if( v < min_value ) {
+							return enum_npos;
+						}
+						auto const offset = enum_value_offset( v, min_value );
+						if( offset > value_span ) {
+							return enum_npos;
+						}
+						return by_value[static_cast<std::size_t>( offset )];
+					} else {
+						std::size_t first = 0;
+						std::size_t last = size;
+						while( first < last ) {
+							std::size_t const mid = first + ( last - first ) / 2;
+							if( enum_value_at<EnumNames>( by_value[mid] ) < v ) {
+								first = mid + 1;
+							} else {
+								last = mid;
+							}
+						}
+						if( first < size and
+						    enum_value_at<EnumNames>( by_value[first] ) == v ) {
+							return by_value[first];
+						}
+						return enum_npos;
+					}
+				}
+
+				[[nodiscard]] static constexpr Enum parse( std::string_view name ) {
+					std::size_t const idx = find_name( name );
+					daw_json_ensure( idx != enum_npos, ErrorReason::UnknownEnumValue );
+					return EnumNames::values[idx].value;
+				}
+
+				[[nodiscard]] static constexpr std::string_view name_of( Enum value ) {
+					std::size_t const idx = find_value( value );
+					daw_json_ensure( idx != enum_npos, ErrorReason::UnknownEnumValue );
+					return EnumNames::values[idx].name;
+				}
+			};
+
+			template<typename Enum, typename EnumNames>
+			using enum_names_t =
+			  std::conditional_t<std::is_same_v<use_default, EnumNames>,
+			                     json_enum_names<Enum>, EnumNames>;
+
+			/// @brief FromJsonConverter used by json_enum
+			template<typename Enum, typename EnumNames>
+			struct enum_from_json_converter {
+				using table_t = enum_name_table<Enum, enum_names_t<Enum, EnumNames>>;
+
+				[[nodiscard]] DAW_ATTRIB_INLINE DAW_JSON_CPP23_STATIC_CALL_OP
+				  constexpr Enum
+				  operator( )( std::string_view name )
+				    DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+					return table_t::parse( name );
+				}
+			};
+
+			/// @brief ToJsonConverter used by json_enum.  Names never need escaping
+			/// so they are written directly
+			template<typename Enum, typename EnumNames>
+			struct enum_to_json_converter {
+				using table_t = enum_name_table<Enum, enum_names_t<Enum, EnumNames>>;
+
+				[[nodiscard]] DAW_ATTRIB_INLINE DAW_JSON_CPP23_STATIC_CALL_OP
+				  constexpr std::string_view
+				  operator( )( Enum value ) DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+					return table_t::name_of( value );
+				}
+
+				template<typename WritableType>
+				[[nodiscard]] DAW_ATTRIB_INLINE DAW_JSON_CPP23_STATIC_CALL_OP
+				  constexpr WritableType
+				  operator( )( WritableType it, Enum value )
+				    DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+					auto const name = table_t::name_of( value );
+					it.write( daw::string_view( name.data( ), name.size( ) ) );
+					return it;
+				}
+			};
+		} // namespace json_details
+	}   // namespace DAW_JSON_VER
+} // namespace daw::json
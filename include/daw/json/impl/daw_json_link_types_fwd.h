@@ -10,6 +10,7 @@
 
 #include "version.h"
 
+#include "daw_json_enum_mapping.h"
 #include "daw_json_enums.h"
 #include "daw_json_link_types_iso8601.h"
 #include "daw_json_parse_class.h"
@@ -497,6 +498,43 @@ namespace daw::json {
 		                           Options, options::JsonCustomTypes::Literal>>,
 		  NullableType, Constructor>;
 
+		/***
+		 * @brief Map an enum to/from a fixed set of JSON strings.  The lookup
+		 * tables are built at compile time from EnumNames
+		 * @tparam Name Name of JSON member to link to
+		 * @tparam Enum enum type being mapped
+		 * @tparam EnumNames Type with a static constexpr array named values of
+		 * json_enum_entry<Enum>.  Defaults to json_enum_names<Enum>
+		 */
+		template<JSONNAMETYPE Name, typename Enum, typename EnumNames = use_default>
+		using json_enum =
+		  json_custom<Name, Enum,
+		              json_details::enum_from_json_converter<Enum, EnumNames>,
+		              json_details::enum_to_json_converter<Enum, EnumNames>>;
+
+		/***
+		 * @brief Map a nullable enum to/from a fixed set of JSON strings
+		 * @tparam Name Name of JSON member to link to
+		 * @tparam WrappedEnum nullable type holding the enum, e.g.
+		 * std::optional<Enum>
+		 * @tparam EnumNames Type with a static constexpr array named values of
+		 * json_enum_entry<Enum>.  Defaults to json_enum_names<Enum>
+		 */
+		template<JSONNAMETYPE Name, typename WrappedEnum,
+		         typename EnumNames = use_default,
+		         JsonNullable NullableType = JsonNullable::Nullable,
+		         typename Constructor = use_default>
+		using json_enum_null = json_nullable<
+		  Name, WrappedEnum,
+		  json_base::json_custom<
+		    json_details::unwrapped_t<WrappedEnum>,
+		    json_details::enum_from_json_converter<
+		      json_details::unwrapped_t<WrappedEnum>, EnumNames>,
+		    json_details::enum_to_json_converter<
+		      json_details::unwrapped_t<WrappedEnum>, EnumNames>,
+		    json_custom_opts_def>,
+		  NullableType, Constructor>;
+
 		namespace json_details {
 			template<JsonBaseParseTypes PT>
 			constexpr std::size_t
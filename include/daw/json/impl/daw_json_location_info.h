@@ -10,6 +10,7 @@
 
 #include "version.h"
 
+#include "../daw_json_parser_statistics.h"
 #include "daw_json_assert.h"
 #include "daw_murmur3.h"
 
@@ -44,6 +45,9 @@ namespace daw::json {
 				CharT *class_first = nullptr;
 				CharT *class_last = nullptr;
 				std::size_t counter = 0;
+				// The value was skipped and is a string, see
+				// restore_skipped_string_quotes
+				bool is_string = false;
 
 				[[nodiscard]] inline constexpr bool missing( ) const {
 					return first == nullptr;
@@ -74,6 +78,9 @@ namespace daw::json {
 				CharT *class_first = nullptr;
 				CharT *class_last = nullptr;
 				std::size_t counter = 0;
+				// The value was skipped and is a string, see
+				// restore_skipped_string_quotes
+				bool is_string = false;
 
 				[[nodiscard]] inline constexpr bool missing( ) const {
 					return first == nullptr;
@@ -140,6 +147,7 @@ namespace daw::json {
 						if( hashes[n] == hash ) {
 							if constexpr( do_full_name_match ) {
 								if( DAW_UNLIKELY( key != names[n].name ) ) {
+									count_parser_statistic<parser_statistic::hash_collisions>( );
 									continue;
 								}
 							}
@@ -242,7 +250,9 @@ namespace daw::json {
 #endif
 						if( name_pos >= std::size( locations ) ) {
 							// This is not a member we are concerned with
-							(void)skip_value( parse_state );
+							count_parser_statistic<parser_statistic::unknown_members>( );
+							count_parser_statistic<parser_statistic::skipped_bytes>(
+							  std::size( skip_value( parse_state ) ) );
 							parse_state.move_next_member_or_end( );
 							continue;
 						}
@@ -260,6 +270,8 @@ namespace daw::json {
 						                       static_cast<long long>( name_pos ) )
 						          << " members ahead in constructor\n";
 #endif
+						count_parser_statistic<
+						  parser_statistic::out_of_order_members>( );
 						// We are out of order, store position for later
 						// OLDTODO:	use type knowledge to speed up skip
 						// OLDTODO:	on skipped classes see if way to store
@@ -268,7 +280,10 @@ namespace daw::json {
 						// RESULT: storing preparsed is slower, don't try 3 times
 						// it also limits the type of things we can parse potentially
 						// Using locations to switch on BaseType is slower too
+						bool const is_string =
+						  parse_state.has_more( ) and parse_state.front( ) == '"';
 						locations[name_pos].set_range( skip_value( parse_state ) );
+						locations[name_pos].is_string = is_string;
 
 						if constexpr( ParseState::is_unchecked_input ) {
 							if( name_pos + 1 < std::size( locations ) ) {
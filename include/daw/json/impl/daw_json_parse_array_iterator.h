@@ -17,6 +17,7 @@
 #include <daw/daw_attributes.h>
 
 #include <ciso646>
+#include <cstddef>
 #include <type_traits>
 
 namespace daw::json {
@@ -58,13 +59,34 @@ namespace daw::json {
 				}
 			};
 
+			/// @brief The index of the current element is only kept when parsing
+			/// with options::ErrorContext::yes, so that it can be added to the path
+			/// of a json_exception
+			template<bool TrackIndex>
+			struct json_parse_array_iterator_index {
+				static constexpr void next_element_index( ) {}
+			};
+
+			template<>
+			struct json_parse_array_iterator_index<true> {
+				std::size_t element_index = 0;
+
+				constexpr void next_element_index( ) {
+					++element_index;
+				}
+			};
+
 			template<typename JsonMember, typename ParseState, bool KnownBounds>
 			struct json_parse_array_iterator
-			  : json_parse_array_iterator_base<ParseState, can_be_random_iterator_v<KnownBounds>> {
+			  : json_parse_array_iterator_base<ParseState,
+			                                   can_be_random_iterator_v<KnownBounds>>,
+			    json_parse_array_iterator_index<ParseState::track_error_context> {
 
 				using base =
 				  json_parse_array_iterator_base<ParseState,
 				                                 can_be_random_iterator_v<KnownBounds>>;
+				using index_base =
+				  json_parse_array_iterator_index<ParseState::track_error_context>;
 
 				using iterator_category = typename base::iterator_category;
 				using element_t = typename JsonMember::json_element_t;
@@ -110,8 +132,19 @@ namespace daw::json {
 					  base::parse_state and base::parse_state->has_more( ),
 					  ErrorReason::UnexpectedEndOfData, *base::parse_state );
 
-					return parse_value<element_t>(
-					  *base::parse_state, ParseTag<element_t::expected_type>{ } );
+					if constexpr( ParseState::track_error_context ) {
+						return invoke_with_error_context(
+						  [&]( ) -> value_type {
+							  return parse_value<element_t>(
+							    *base::parse_state, ParseTag<element_t::expected_type>{ } );
+						  },
+						  [&]( json_exception &jex ) {
+							  jex.prepend_index_path( index_base::element_index );
+						  } );
+					} else {
+						return parse_value<element_t>(
+						  *base::parse_state, ParseTag<element_t::expected_type>{ } );
+					}
 				}
 
 				DAW_ATTRIB_INLINE constexpr json_parse_array_iterator &operator++( ) {
@@ -126,6 +159,7 @@ namespace daw::json {
 					  ErrorReason::UnexpectedEndOfData, *base::parse_state );
 
 					base::parse_state->move_next_member_or_end( );
+					index_base::next_element_index( );
 					daw_json_assert_weak( base::parse_state->has_more( ),
 					                      ErrorReason::UnexpectedEndOfData,
 					                      *base::parse_state );
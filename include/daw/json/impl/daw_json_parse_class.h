@@ -11,6 +11,7 @@
 #include "version.h"
 
 #include "../daw_json_exception.h"
+#include "../daw_json_parser_statistics.h"
 #include "daw_json_assert.h"
 #include "daw_json_location_info.h"
 #include "daw_json_name.h"
@@ -47,9 +48,9 @@ namespace daw::json {
 			///
 			template<typename JsonMember, typename ParseState>
 			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr json_result<JsonMember>
-			parse_ordered_class_member( template_param<JsonMember>,
-			                            std::size_t &member_index,
-			                            ParseState &parse_state ) {
+			parse_ordered_class_member_impl( template_param<JsonMember>,
+			                                 std::size_t &member_index,
+			                                 ParseState &parse_state ) {
 
 				using json_member_t = ordered_member_subtype_t<JsonMember>;
 
@@ -84,6 +85,27 @@ namespace daw::json {
 				  parse_state, ParseTag<json_member_t::expected_type>{ } );
 			}
 
+			template<typename JsonMember, typename ParseState>
+			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr json_result<JsonMember>
+			parse_ordered_class_member( template_param<JsonMember> tp,
+			                            std::size_t &member_index,
+			                            ParseState &parse_state ) {
+				if constexpr( ParseState::track_error_context ) {
+					return invoke_with_error_context(
+					  [&]( ) -> json_result<JsonMember> {
+						  return parse_ordered_class_member_impl( tp, member_index,
+						                                          parse_state );
+					  },
+					  [&]( json_exception &jex ) {
+						  // member_index has already moved past the member
+						  jex.prepend_index_path( member_index - 1U );
+					  } );
+				} else {
+					return parse_ordered_class_member_impl( tp, member_index,
+					                                        parse_state );
+				}
+			}
+
 			///
 			///@brief Parse a member from a json_class
 			///@tparam member_position position in json_class member list
@@ -98,8 +120,8 @@ namespace daw::json {
 			         AllMembersMustExist must_exist, bool NeedsClassPositions,
 			         typename ParseState, std::size_t N, typename CharT, bool B>
 			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr json_result<JsonMember>
-			parse_class_member( ParseState &parse_state,
-			                    locations_info_t<N, CharT, B> &locations ) {
+			parse_class_member_impl( ParseState &parse_state,
+			                         locations_info_t<N, CharT, B> &locations ) {
 				parse_state.move_next_member_or_end( );
 
 				daw_json_assert_weak( parse_state.is_at_next_class_member( ),
@@ -148,10 +170,42 @@ namespace daw::json {
 				}
 
 				// Member was previously skipped
+				restore_skipped_string_quotes<without_name<JsonMember>>(
+				  loc, locations[member_position].is_string );
 				return parse_value<without_name<JsonMember>, true>(
 				  loc, ParseTag<JsonMember::expected_type>{ } );
 			}
 
+			///
+			///@brief Parse a member from a json_class.  With
+			/// options::ErrorContext::yes, the member name is added to the path of
+			/// any json_exception that escapes
+			///
+			template<std::size_t member_position, typename JsonMember,
+			         AllMembersMustExist must_exist, bool NeedsClassPositions,
+			         typename ParseState, std::size_t N, typename CharT, bool B>
+			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr json_result<JsonMember>
+			parse_class_member( ParseState &parse_state,
+			                    locations_info_t<N, CharT, B> &locations ) {
+				if constexpr( ParseState::track_error_context ) {
+					return invoke_with_error_context(
+					  [&]( ) -> json_result<JsonMember> {
+						  return parse_class_member_impl<member_position, JsonMember,
+						                                 must_exist, NeedsClassPositions>(
+						    parse_state, locations );
+					  },
+					  []( json_exception &jex ) {
+						  jex.prepend_member_path(
+						    std::string_view( std::data( JsonMember::name ),
+						                      std::size( JsonMember::name ) ) );
+					  } );
+				} else {
+					return parse_class_member_impl<member_position, JsonMember,
+					                               must_exist, NeedsClassPositions>(
+					  parse_state, locations );
+				}
+			}
+
 			template<bool IsExactClass, typename ParseState, typename OldClassPos>
 			DAW_ATTRIB_INLINE static constexpr void
 			class_cleanup_now( ParseState &parse_state,
@@ -198,6 +252,10 @@ namespace daw::json {
 				// TODO, use member name
 				daw_json_assert_weak( parse_state.is_opening_brace_checked( ),
 				                      ErrorReason::InvalidClassStart, parse_state );
+#if defined( DAW_JSON_PARSER_STATISTICS )
+				auto const statistics_scope =
+				  class_statistics_scope<T>( parse_state );
+#endif
 
 				auto const old_class_pos = parse_state.get_class_position( );
 				parse_state.set_class_position( );
@@ -12,6 +12,7 @@
 
 #include "daw_json_assert.h"
 #include "daw_json_parse_digit.h"
+#include "daw_json_parse_unsigned_int.h"
 
 #include <daw/daw_arith_traits.h>
 #include <daw/daw_cpp_feature_check.h>
@@ -19,8 +20,10 @@
 #include <daw/daw_traits.h>
 #include <daw/daw_uint_buffer.h>
 
+#include <array>
 #include <chrono>
 #include <ciso646>
+#include <cstddef>
 #include <cstdint>
 
 namespace daw::json {
@@ -80,6 +83,199 @@ namespace daw::json {
 					}
 					return result * sign;
 				}
+
+				/// Days since 1970-01-01 of the civil date y-m-d
+				constexpr std::int_least32_t days_from_civil( std::int_least32_t y,
+				                                              std::uint_least32_t m,
+				                                              std::uint_least32_t d ) {
+					y -= static_cast<std::int_least32_t>( m ) <= 2;
+					std::int_least32_t const era = ( y >= 0 ? y : y - 399 ) / 400;
+					auto const yoe = static_cast<std::uint_least32_t>(
+					  static_cast<std::int_least32_t>( y ) - era * 400 ); // [0, 399]
+					auto const doy = static_cast<std::uint_least32_t>(
+					  ( 153 * ( static_cast<std::int_least32_t>( m ) +
+					            ( static_cast<std::int_least32_t>( m ) > 2 ? -3 : 9 ) ) +
+					    2 ) /
+					    5 +
+					  static_cast<std::int_least32_t>( d ) - 1 ); // [0, 365]
+					std::uint_least32_t const doe =
+					  yoe * 365 + yoe / 4 - yoe / 100 + doy; // [0, 146096]
+					return era * 146097 + static_cast<std::int_least32_t>( doe ) - 719468;
+				}
+
+				/// Years with a precomputed days_from_civil( year, 1, 1 )
+				inline constexpr std::int_least32_t cached_year_first = 1900;
+				inline constexpr std::int_least32_t cached_year_last = 2100;
+
+				constexpr std::array<std::int_least32_t,
+				                     cached_year_last - cached_year_first>
+				make_year_start_days( ) {
+					auto result = std::array<std::int_least32_t,
+					                         cached_year_last - cached_year_first>{ };
+					for( std::size_t n = 0; n < result.size( ); ++n ) {
+						result[n] = days_from_civil(
+						  cached_year_first + static_cast<std::int_least32_t>( n ), 1, 1 );
+					}
+					return result;
+				}
+
+				inline constexpr auto year_start_days = make_year_start_days( );
+
+				inline constexpr std::uint_least16_t days_before_month[2][12] = {
+				  { 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 },
+				  { 0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335 } };
+
+				constexpr bool is_leap_year( std::int_least32_t y ) {
+					return ( y % 4 == 0 and y % 100 != 0 ) or y % 400 == 0;
+				}
+
+				/// days_from_civil using the per year cache when possible.  m must be
+				/// in [1, 12]
+				constexpr std::int_least32_t
+				cached_days_from_civil( std::int_least32_t y, std::uint_least32_t m,
+				                        std::uint_least32_t d ) {
+					if( y >= cached_year_first and y < cached_year_last ) {
+						return year_start_days[static_cast<std::size_t>(
+						         y - cached_year_first )] +
+						       static_cast<std::int_least32_t>(
+						         days_before_month[is_leap_year( y )][m - 1] + d ) -
+						       1;
+					}
+					return days_from_civil( y, m, d );
+				}
+
+				struct fixed_timestamp {
+					bool is_valid;
+					std::int_least64_t milliseconds;
+				};
+
+				/***
+				 * Parse the common fixed layouts YYYY-MM-DDTHH:MM:SS[.fff] followed by
+				 * nothing, Z, or a (+|-)hh[:]mm offset.  The 14 date/time digits are
+				 * gathered and validated with two 8 digit SWAR operations.  When the
+				 * layout does not match, is_valid is false and the general parser is
+				 * used
+				 */
+				constexpr fixed_timestamp parse_iso8601_fixed( char const *ptr,
+				                                               std::size_t sz ) {
+					if( sz < 19 or ptr[4] != '-' or ptr[7] != '-' or ptr[10] != 'T' or
+					    ptr[13] != ':' or ptr[16] != ':' ) {
+						return { false, 0 };
+					}
+					std::size_t pos = 19;
+					char frac[3] = { '0', '0', '0' };
+					if( pos < sz and ptr[pos] == '.' ) {
+						if( sz - pos < 4 or
+						    ( sz - pos > 4 and parse_utils::is_number( ptr[pos + 4] ) ) ) {
+							// Only exactly 3 fractional digits are handled here
+							return { false, 0 };
+						}
+						frac[0] = ptr[pos + 1];
+						frac[1] = ptr[pos + 2];
+						frac[2] = ptr[pos + 3];
+						pos += 4;
+					}
+					char const ymd[8] = { ptr[0], ptr[1], ptr[2], ptr[3],
+					                      ptr[5], ptr[6], ptr[8], ptr[9] };
+					char const hmsf[8] = { ptr[11], ptr[12], ptr[14], ptr[15],
+					                       ptr[17], ptr[18], frac[0], frac[1] };
+					unsigned const frac2 = json_details::parse_digit( frac[2] );
+					if( not( json_details::is_made_of_eight_digits_cx( ymd ) and
+					         json_details::is_made_of_eight_digits_cx( hmsf ) and
+					         frac2 < 10U ) ) {
+						return { false, 0 };
+					}
+
+					std::int_least64_t offset_minutes = 0;
+					std::size_t const tz_size = sz - pos;
+					if( tz_size == 1 and ptr[pos] == 'Z' ) {
+						// UTC
+					} else if( ( tz_size == 5 or
+					             ( tz_size == 6 and ptr[pos + 3] == ':' ) ) and
+					           ( ptr[pos] == '+' or ptr[pos] == '-' ) ) {
+						char const *const off_min = ptr + pos + tz_size - 2;
+						unsigned const digs[4] = {
+						  json_details::parse_digit( ptr[pos + 1] ),
+						  json_details::parse_digit( ptr[pos + 2] ),
+						  json_details::parse_digit( off_min[0] ),
+						  json_details::parse_digit( off_min[1] ) };
+						if( ( digs[0] | digs[1] | digs[2] | digs[3] ) >= 10U ) {
+							return { false, 0 };
+						}
+						offset_minutes = static_cast<std::int_least64_t>(
+						  ( digs[0] * 10U + digs[1] ) * 60U + digs[2] * 10U + digs[3] );
+						// Converting to UTC, so a positive offset is subtracted
+						if( ptr[pos] == '+' ) {
+							offset_minutes = -offset_minutes;
+						}
+					} else if( tz_size != 0 ) {
+						return { false, 0 };
+					}
+
+					auto const ymd_val = static_cast<std::uint_least32_t>(
+					  json_details::parse_8_digits( ymd ) );
+					auto const month = ( ymd_val / 100U ) % 100U;
+					auto const day = ymd_val % 100U;
+					if( month - 1U >= 12U or day - 1U >= 31U ) {
+						return { false, 0 };
+					}
+					auto const hmsf_val = static_cast<std::uint_least32_t>(
+					  json_details::parse_8_digits( hmsf ) );
+
+					std::int_least64_t const days = cached_days_from_civil(
+					  static_cast<std::int_least32_t>( ymd_val / 10000U ), month, day );
+					std::int_least64_t const minutes =
+					  days * 1440 +
+					  static_cast<std::int_least64_t>( ( hmsf_val / 1000000U ) * 60U +
+					                                   ( hmsf_val / 10000U ) % 100U ) +
+					  offset_minutes;
+					std::int_least64_t const ms =
+					  ( minutes * 60 +
+					    static_cast<std::int_least64_t>( ( hmsf_val / 100U ) % 100U ) ) *
+					    1000 +
+					  static_cast<std::int_least64_t>( ( hmsf_val % 100U ) * 10U +
+					                                   frac2 );
+					return { true, ms };
+				}
+
+				/// Maximum size of the output of format_iso8601_fixed
+				inline constexpr std::size_t iso8601_fixed_max_size = 24;
+
+				constexpr char *put_2_digits( char *ptr, std::uint_least32_t v ) {
+					ptr[0] = static_cast<char>( '0' + v / 10U );
+					ptr[1] = static_cast<char>( '0' + v % 10U );
+					return ptr + 2;
+				}
+
+				/***
+				 * Write YYYY-MM-DDTHH:MM:SS[.fff]Z into buff, which must hold
+				 * iso8601_fixed_max_size characters.  The year must be in [0, 9999]
+				 * @return number of characters written
+				 */
+				template<typename YMDHMS>
+				constexpr std::size_t format_iso8601_fixed( YMDHMS const &civil,
+				                                            char *buff ) {
+					auto const year = static_cast<std::uint_least32_t>( civil.year );
+					char *ptr = put_2_digits( buff, year / 100U );
+					ptr = put_2_digits( ptr, year % 100U );
+					*ptr++ = '-';
+					ptr = put_2_digits( ptr, civil.month );
+					*ptr++ = '-';
+					ptr = put_2_digits( ptr, civil.day );
+					*ptr++ = 'T';
+					ptr = put_2_digits( ptr, civil.hour );
+					*ptr++ = ':';
+					ptr = put_2_digits( ptr, civil.minute );
+					*ptr++ = ':';
+					ptr = put_2_digits( ptr, civil.second );
+					if( civil.millisecond > 0 ) {
+						*ptr++ = '.';
+						*ptr++ = static_cast<char>( '0' + civil.millisecond / 100U );
+						ptr = put_2_digits( ptr, civil.millisecond % 100U );
+					}
+					*ptr++ = 'Z';
+					return static_cast<std::size_t>( ptr - buff );
+				}
 			} // namespace datetime_details
 			// See:
 			// https://stackoverflow.com/questions/16773285/how-to-convert-stdchronotime-point-to-stdtm-without-using-time-t
@@ -95,20 +291,8 @@ namespace daw::json {
 				                          std::uint_least32_t min,
 				                          std::uint_least32_t s,
 				                          std::uint_least32_t mil ) {
-					y -= static_cast<std::int_least32_t>( m ) <= 2;
-					std::int_least32_t const era = ( y >= 0 ? y : y - 399 ) / 400;
-					auto const yoe = static_cast<std::uint_least32_t>(
-					  static_cast<std::int_least32_t>( y ) - era * 400 ); // [0, 399]
-					auto const doy = static_cast<std::uint_least32_t>(
-					  ( 153 * ( static_cast<std::int_least32_t>( m ) +
-					            ( static_cast<std::int_least32_t>( m ) > 2 ? -3 : 9 ) ) +
-					    2 ) /
-					    5 +
-					  static_cast<std::int_least32_t>( d ) - 1 ); // [0, 365]
-					std::uint_least32_t const doe =
-					  yoe * 365 + yoe / 4 - yoe / 100 + doy; // [0, 146096]
 					std::int_least32_t const days_since_epoch =
-					  era * 146097 + static_cast<std::int_least32_t>( doe ) - 719468;
+					  datetime_details::days_from_civil( y, m, d );
 
 					using Days =
 					  std::chrono::duration<std::int_least32_t, std::ratio<86400>>;
@@ -227,6 +411,13 @@ namespace daw::json {
 			constexpr std::chrono::time_point<std::chrono::system_clock,
 			                                  std::chrono::milliseconds>
 			parse_iso8601_timestamp( daw::basic_string_view<char, Bounds> ts ) {
+				auto const fixed = datetime_details::parse_iso8601_fixed(
+				  std::data( ts ), std::size( ts ) );
+				if( DAW_LIKELY( fixed.is_valid ) ) {
+					return std::chrono::time_point<std::chrono::system_clock,
+					                               std::chrono::milliseconds>(
+					  std::chrono::milliseconds( fixed.milliseconds ) );
+				}
 				constexpr daw::string_view t_str = "T";
 				auto const date_str = ts.pop_front_until( t_str );
 				if( ts.empty( ) ) {
@@ -241,33 +432,37 @@ namespace daw::json {
 					            ( c == '.' ) );
 				} );
 				// TODO: verify or parse timezone
-				time_parts hms = parse_iso_8601_time( time_str );
+				time_parts const hms = parse_iso_8601_time( time_str );
+				auto result =
+				  civil_to_time_point( ymd.year, ymd.month, ymd.day, hms.hour,
+				                       hms.minute, hms.second, hms.millisecond );
 				if( not( ts.empty( ) or ts.front( ) == 'Z' ) ) {
 					daw_json_ensure( std::size( ts ) == 5 or std::size( ts ) == 6,
 					                 ErrorReason::InvalidTimestamp );
 					// The format will be (+|-)hh[:]mm
 					bool const sign = ts.front( ) == '+';
 					ts.remove_prefix( );
-					auto hr_offset = parse_utils::parse_unsigned<std::uint_least32_t, 2>(
-					  std::data( ts ) );
+					auto const hr_offset =
+					  parse_utils::parse_unsigned<std::uint_least32_t, 2>(
+					    std::data( ts.pop_front( 2 ) ) );
 					if( ts.front( ) == ':' ) {
 						ts.remove_prefix( );
 					}
-					auto mn_offset = parse_utils::parse_unsigned<std::uint_least32_t, 2>(
-					  std::data( ts ) );
+					auto const mn_offset =
+					  parse_utils::parse_unsigned<std::uint_least32_t, 2>(
+					    std::data( ts ) );
+					auto const offset = std::chrono::minutes(
+					  static_cast<std::int_least32_t>( hr_offset * 60U + mn_offset ) );
 					// Want to subtract offset from current time, we are converting to UTC
 					if( sign ) {
 						// Positive offset
-						hms.hour -= hr_offset;
-						hms.minute -= mn_offset;
+						result -= offset;
 					} else {
 						// Negative offset
-						hms.hour += hr_offset;
-						hms.minute += mn_offset;
+						result += offset;
 					}
 				}
-				return civil_to_time_point( ymd.year, ymd.month, ymd.day, hms.hour,
-				                            hms.minute, hms.second, hms.millisecond );
+				return result;
 			}
 			struct ymdhms {
 				std::int_least32_t year;
@@ -157,6 +157,14 @@ namespace daw::json {
 			  default_json_option_value<options::ExcludeSpecialEscapes> =
 			    options::ExcludeSpecialEscapes::no;
 
+			template<>
+			inline constexpr unsigned json_option_bits_width<options::ErrorContext> =
+			  1;
+
+			template<>
+			inline constexpr auto default_json_option_value<options::ErrorContext> =
+			  options::ErrorContext::no;
+
 			using policy_list = typename option_list_impl<
 			  options::ExecModeTypes, options::ZeroTerminatedString,
 			  options::PolicyCommentTypes, options::CheckedParseMode,
@@ -164,7 +172,7 @@ namespace daw::json {
 			  options::ForceFullNameCheck, options::MinifiedDocument,
 			  options::UseExactMappingsByDefault, options::TemporarilyMutateBuffer,
 			  options::MustVerifyEndOfDataIsValid, options::ExcludeSpecialEscapes,
-			  options::ExpectLongNames>::type;
+			  options::ExpectLongNames, options::ErrorContext>::type;
 
 			template<typename Policy, typename Policies>
 			inline constexpr unsigned basic_policy_bits_start =
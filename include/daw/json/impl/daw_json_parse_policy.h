@@ -150,6 +150,13 @@ namespace daw::json {
 			  json_details::get_bits_for<options::ExpectLongNames>( PolicyFlags ) ==
 			  options::ExpectLongNames::yes;
 
+			/***
+			 * See options::ErrorContext
+			 */
+			static constexpr bool track_error_context =
+			  json_details::get_bits_for<options::ErrorContext>( PolicyFlags ) ==
+			  options::ErrorContext::yes;
+
 			using CommentPolicy =
 			  switch_t<json_details::get_bits_for<options::PolicyCommentTypes,
 			                                      std::size_t>( PolicyFlags ),
@@ -10,9 +10,11 @@
 
 #include "version.h"
 
+#include "../daw_json_parser_statistics.h"
 #include "daw_fp_fallback.h"
 #include "daw_json_assert.h"
 #include "daw_json_parse_policy_policy_details.h"
+#include "daw_json_parse_real_eisel_lemire.h"
 #include "daw_json_parse_real_power10.h"
 #include "daw_json_parse_unsigned_int.h"
 #include "daw_json_skip.h"
@@ -114,6 +116,37 @@ namespace daw::json {
 				}
 			}
 
+			/// @brief Used in precise mode when power10 cannot calculate the exact
+			/// result.  double uses Eisel-Lemire, only falling back to
+			/// parse_with_strtod when that cannot determine the result or for other
+			/// types
+			/// @param truncated significant_digits is missing digits and the value
+			/// is in [significant_digits, significant_digits + 1) * 10^exponent
+			template<typename Result, typename ExecTag, typename Unsigned,
+			         typename Signed, typename CharT>
+			[[nodiscard]] static constexpr Result
+			parse_real_precise( ExecTag tag, Result sign, Unsigned significant_digits,
+			                    Signed exponent, bool truncated, CharT *first,
+			                    CharT *last ) {
+				if constexpr( std::is_same_v<Result, double> and
+				              std::is_same_v<Unsigned, std::uint64_t> ) {
+					double result = 0.0;
+					if( DAW_LIKELY( parse_real_eisel_lemire(
+					      tag, sign < 0.0, significant_digits,
+					      static_cast<std::int64_t>( exponent ), truncated, result ) ) ) {
+						return result;
+					}
+				} else {
+					(void)tag;
+					(void)sign;
+					(void)significant_digits;
+					(void)exponent;
+					(void)truncated;
+				}
+				count_parser_statistic<parser_statistic::strtod_fallbacks>( );
+				return json_details::parse_with_strtod<Result>( first, last );
+			}
+
 			template<typename Result, typename ParseState>
 			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr Result
 			parse_real_known( ParseState &parse_state ) {
@@ -174,6 +207,9 @@ namespace daw::json {
 				signed_t exponent = 0;
 
 				if( whole_exponent_available > max_exponent::value ) {
+					if constexpr( ParseState::precise_ieee754( ) ) {
+						use_strtod = true;
+					}
 					whole_last = whole_first + max_exponent::value;
 					whole_exponent_available -= max_exponent::value;
 					fract_exponent_available = 0;
@@ -255,13 +291,15 @@ namespace daw::json {
 				              ParseState::precise_ieee754( ) ) {
 					// On std floating point types, check for conditions that cannot be
 					// precisely calculated using the normal method and use the fallback
-					// method(usually strtod/from_chars)
+					// method(Eisel-Lemire for double, otherwise strtod/from_chars)
+					bool const truncated = use_strtod;
 					use_strtod |= exponent > 22;
 					use_strtod |= exponent < -22;
 					use_strtod |= significant_digits > 9007199254740992ULL;
 					if( DAW_UNLIKELY( use_strtod ) ) {
-						return json_details::parse_with_strtod<Result>( parse_state.first,
-						                                                parse_state.last );
+						return parse_real_precise<Result>(
+						  ParseState::exec_tag, sign, significant_digits, exponent,
+						  truncated, parse_state.first, parse_state.last );
 					}
 				}
 				return sign * power10<Result>(
@@ -456,13 +494,16 @@ namespace daw::json {
 
 				if constexpr( std::is_floating_point_v<Result> and
 				              ParseState::precise_ieee754( ) ) {
+					// Any digits that did not fit in significant_digits were skipped
+					bool const truncated = use_strtod;
 					use_strtod |= DAW_UNLIKELY( exponent > 22 );
 					use_strtod |= DAW_UNLIKELY( exponent < -22 );
 					use_strtod |=
 					  DAW_UNLIKELY( significant_digits > 9007199254740992ULL );
 					if( DAW_UNLIKELY( use_strtod ) ) {
-						using json_details::parse_with_strtod;
-						return parse_with_strtod<Result>( orig_first, orig_last );
+						return parse_real_precise<Result>(
+						  ParseState::exec_tag, sign, significant_digits, exponent,
+						  truncated, orig_first, orig_last );
 					}
 				}
 				return sign * power10<Result>(
@@ -10,6 +10,7 @@
 
 #include "version.h"
 
+#include "../daw_json_parser_statistics.h"
 #include "daw_json_assert.h"
 #include "daw_json_parse_array_iterator.h"
 #include "daw_json_parse_kv_array_iterator.h"
@@ -67,6 +68,39 @@ namespace daw::json {
 				}
 			}
 
+			/// @brief JsonMember parses to a json_deferred, or a nullable one
+			template<typename JsonMember, typename = void>
+			inline constexpr bool is_deferred_member_v =
+			  is_a_json_deferred_v<json_result<JsonMember>>;
+
+			template<typename JsonMember>
+			inline constexpr bool is_deferred_member_v<
+			  JsonMember, std::enable_if_t<is_json_nullable_v<JsonMember>>> =
+			  is_a_json_deferred_v<json_result<typename JsonMember::member_type>>;
+
+			/***
+			 * @brief Skipping a string leaves the range of its contents, which is
+			 * what the other KnownBounds parsers expect.  A json_deferred is
+			 * constructed from the whole value, so the range is widened to include
+			 * the quotes again
+			 * @param parse_state range of a value returned by skip_value
+			 * @param is_string the skipped value was a string
+			 */
+			template<typename JsonMember, typename ParseState>
+			DAW_ATTRIB_INLINE constexpr void
+			restore_skipped_string_quotes( ParseState &parse_state,
+			                               bool is_string ) {
+				if constexpr( is_deferred_member_v<JsonMember> ) {
+					if( is_string ) {
+						--parse_state.first;
+						++parse_state.last;
+					}
+				} else {
+					(void)parse_state;
+					(void)is_string;
+				}
+			}
+
 			template<typename JsonMember, bool KnownBounds = false,
 			         typename ParseState>
 			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr json_result<JsonMember>
@@ -496,6 +530,7 @@ namespace daw::json {
 					if( not AllowHighEightbits::value or
 					    needs_slow_path( parse_state2 ) ) {
 						// There are escapes in the string
+						count_parser_statistic<parser_statistic::escaped_strings>( );
 						return parse_string_known_stdstring<AllowHighEightbits::value,
 						                                    JsonMember, true>(
 						  parse_state2 );
@@ -514,6 +549,7 @@ namespace daw::json {
 					if( not AllowHighEightbits::value or
 					    needs_slow_path( parse_state2 ) ) {
 						// There are escapes in the string
+						count_parser_statistic<parser_statistic::escaped_strings>( );
 						return parse_string_known_stdstring<AllowHighEightbits::value,
 						                                    JsonMember, true>(
 						  parse_state2 );
@@ -633,17 +669,45 @@ namespace daw::json {
 				                      ErrorReason::ExpectedKeyValueToStartWithBrace,
 				                      parse_state );
 
-				parse_state.remove_prefix( );
-				parse_state.trim_left( );
-
+				using constructor_t = typename JsonMember::constructor_t;
 				using iter_t =
 				  json_parse_kv_class_iterator<JsonMember, ParseState,
 				                               can_be_random_iterator_v<KnownBounds>>;
+				if constexpr( presize_key_value_v<json_result<JsonMember>> and
+				              not ParseState::has_allocator and
+				              std::is_same_v<constructor_t,
+				                             default_constructor<json_result<JsonMember>>> ) {
+					// Count the members first so that the container is sized once.
+					// counter is the number of commas between members
+					auto known_state = [&] {
+						if constexpr( KnownBounds ) {
+							return parse_state;
+						} else {
+							auto bounded_state = parse_state.skip_class( );
+							parse_state.trim_left_checked( );
+							return bounded_state;
+						}
+					}( );
+					auto result = json_result<JsonMember>( );
+					result.reserve( known_state.counter + 1U );
 
-				using constructor_t = typename JsonMember::constructor_t;
-				return construct_value(
-				  template_args<json_result<JsonMember>, constructor_t>, parse_state,
-				  iter_t( parse_state ), iter_t( ) );
+					known_state.remove_prefix( );
+					known_state.trim_left( );
+					auto first = iter_t( known_state );
+					auto const last = iter_t( );
+					while( first != last ) {
+						result.insert( *first );
+						++first;
+					}
+					return result;
+				} else {
+					parse_state.remove_prefix( );
+					parse_state.trim_left( );
+
+					return construct_value(
+					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
+					  iter_t( parse_state ), iter_t( ) );
+				}
 			}
 
 			/**
@@ -948,6 +1012,7 @@ namespace daw::json {
 				struct position_info {
 					std::size_t index;
 					ParseState state{ };
+					bool is_string = false;
 
 					constexpr explicit operator bool( ) const {
 						return not state.is_null( );
@@ -961,7 +1026,8 @@ namespace daw::json {
 				 * @param current_position current member index
 				 * @param desired_position desired member index
 				 */
-				template<bool Nullable, typename ParseState, std::size_t N>
+				template<bool Nullable, typename JsonMember, typename ParseState,
+				         std::size_t N>
 				DAW_ATTRIB_INLINE static constexpr ParseState maybe_skip_members(
 				  ParseState &parse_state, std::size_t &current_position,
 				  std::size_t desired_position,
@@ -973,7 +1039,10 @@ namespace daw::json {
 						  return loc.index == desired_position;
 					  } );
 					if( *desired ) {
-						return desired->state;
+						auto result = desired->state;
+						restore_skipped_string_quotes<JsonMember>( result,
+						                                           desired->is_string );
+						return result;
 					}
 #if not defined( NDEBUG )
 					daw_json_ensure( desired != daw::data_end( parse_locations ),
@@ -988,9 +1057,12 @@ namespace daw::json {
 						  [current_position]( position_info<ParseState> const &loc ) {
 							  return loc.index == current_position;
 						  } );
+						bool const is_string =
+						  parse_state.has_more( ) and parse_state.front( ) == '"';
 						auto state = skip_value( parse_state );
 						if( current != daw::data_end( parse_locations ) ) {
 							current->state = state;
+							current->is_string = is_string;
 						}
 						parse_state.move_next_member_or_end( );
 						++current_position;
@@ -1059,7 +1131,8 @@ namespace daw::json {
 
 #if defined( DAW_JSON_BUGFIX_MSVC_EVAL_ORDER_002 )
 					ParseState parse_state2 =
-					  pocm_details::maybe_skip_members<is_json_nullable_v<json_member_t>>(
+					  pocm_details::maybe_skip_members<is_json_nullable_v<json_member_t>,
+					                                   json_member_t>(
 					    parse_state, ClassIdx, /*index_t::value*/
 					    pocm_details::member_index_v<index_t, CurrentMember>,
 					    parse_locations );
@@ -1182,7 +1255,41 @@ namespace daw::json {
 			DAW_ATTRIB_INLINE static constexpr json_result<JsonMember>
 			parse_value_unknown( ParseState &parse_state ) {
 				using constructor_t = typename JsonMember::constructor_t;
-				if constexpr( KnownBounds ) {
+				if constexpr( is_a_json_deferred_v<json_result<JsonMember>> ) {
+					if constexpr( KnownBounds ) {
+						// The range is the whole value, strings include their quotes.  See
+						// restore_skipped_string_quotes.  It may not come from
+						// skip_value, e.g. a root value, so its counter is not the
+						// element count and they are counted instead
+						return construct_value(
+						  template_args<json_result<JsonMember>, constructor_t>,
+						  parse_state, std::data( parse_state ), std::size( parse_state ) );
+					} else {
+						bool const is_string =
+						  parse_state.has_more( ) and parse_state.front( ) == '"';
+						auto value_parse_state = skip_value( parse_state );
+						// Pass on what skipping the value already found, counter is the
+						// number of commas between elements/members
+						std::size_t element_count = 0;
+						if( is_string ) {
+							--value_parse_state.first;
+							++value_parse_state.last;
+						} else if( value_parse_state.is_opening_bracket_checked( ) or
+						           value_parse_state.is_opening_brace_checked( ) ) {
+							auto inner = value_parse_state;
+							inner.remove_prefix( );
+							inner.trim_left( );
+							if( inner.has_more( ) and inner.front( ) != ']' and
+							    inner.front( ) != '}' ) {
+								element_count = value_parse_state.counter + 1U;
+							}
+						}
+						return construct_value(
+						  template_args<json_result<JsonMember>, constructor_t>,
+						  parse_state, std::data( value_parse_state ),
+						  std::size( value_parse_state ), element_count );
+					}
+				} else if constexpr( KnownBounds ) {
 					return construct_value(
 					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
 					  std::data( parse_state ), std::size( parse_state ) );
@@ -0,0 +1,144 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "../daw_json_exception.h"
+#include "daw_json_assert.h"
+#include "daw_json_serialize_options_impl.h"
+#include "daw_json_skip.h"
+
+#include <ciso646>
+#include <string>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief Are there chars that are not whitespace, e.g. the end of the
+			/// document is not found
+			template<typename ParseState>
+			constexpr void ensure_has_more( ParseState const &parse_state ) {
+				daw_json_ensure( parse_state.has_more( ),
+				                 ErrorReason::UnexpectedEndOfData, parse_state );
+			}
+
+			/// @brief Copy the member name at the front of parse_state and its
+			/// separator, leaving parse_state at the member's value
+			template<typename ParseState, typename OutputPolicy>
+			constexpr void reformat_member_name( ParseState &parse_state,
+			                                     OutputPolicy &out_it ) {
+				ensure_has_more( parse_state );
+				daw_json_ensure( parse_state.front( ) == '"',
+				                 ErrorReason::InvalidMemberName, parse_state );
+				auto const name = skip_string( parse_state );
+				out_it.copy_buffer( name.first - 1, name.last + 1 );
+				parse_state.trim_left_checked( );
+				ensure_has_more( parse_state );
+				if( DAW_UNLIKELY( parse_state.front( ) != ':' ) ) {
+					daw_json_error( missing_token( ':' ), parse_state );
+				}
+				parse_state.remove_prefix( );
+				parse_state.trim_left_checked( );
+				out_it.write( ':', out_it.space );
+			}
+
+			/// @brief Is c part of a number or a literal(true/false/null)
+			constexpr bool is_number_or_literal_char( char c ) {
+				return ( c >= '0' and c <= '9' ) or ( c >= 'a' and c <= 'z' ) or
+				       c == '-' or c == '+' or c == '.' or c == 'E';
+			}
+
+			/***
+			 * @brief Copy the JSON value at the front of parse_state to out_it,
+			 * with the whitespace and indentation of out_it's SerializationFormat.
+			 * Strings, numbers and literals are copied as whole spans.  Brackets are
+			 * matched, the tokens themselves are not validated
+			 */
+			template<typename ParseState, typename OutputPolicy>
+			void reformat_json( ParseState &parse_state, OutputPolicy &out_it ) {
+				// The closing bracket of each open class/array.  Small enough to stay
+				// in the small string buffer for most documents
+				std::string closers{ };
+				parse_state.trim_left_checked( );
+				while( true ) {
+					ensure_has_more( parse_state );
+					char const c = parse_state.front( );
+					switch( c ) {
+					case '"': {
+						auto const str = skip_string( parse_state );
+						out_it.copy_buffer( str.first - 1, str.last + 1 );
+						break;
+					}
+					case '{':
+					case '[': {
+						char const closer = c == '{' ? '}' : ']';
+						parse_state.remove_prefix( );
+						parse_state.trim_left_checked( );
+						ensure_has_more( parse_state );
+						out_it.put( c );
+						if( parse_state.front( ) == closer ) {
+							parse_state.remove_prefix( );
+							out_it.put( closer );
+							break;
+						}
+						closers.push_back( closer );
+						out_it.add_indent( );
+						out_it.next_member( );
+						if( closer == '}' ) {
+							reformat_member_name( parse_state, out_it );
+						}
+						continue;
+					}
+					default: {
+						auto const first = parse_state.first;
+						while( parse_state.has_more( ) and
+						       is_number_or_literal_char( parse_state.front( ) ) ) {
+							parse_state.remove_prefix( );
+						}
+						daw_json_ensure( parse_state.first != first,
+						                 ErrorReason::InvalidStartOfValue, parse_state );
+						out_it.copy_buffer( first, parse_state.first );
+					}
+					}
+					// A value has been written, close the classes/arrays that end here
+					parse_state.trim_left_checked( );
+					while( not closers.empty( ) ) {
+						ensure_has_more( parse_state );
+						char const next = parse_state.front( );
+						parse_state.remove_prefix( );
+						if( next == ',' ) {
+							parse_state.trim_left_checked( );
+							out_it.put( ',' );
+							out_it.next_member( );
+							if( closers.back( ) == '}' ) {
+								reformat_member_name( parse_state, out_it );
+							}
+							break;
+						}
+						daw_json_ensure( next == closers.back( ),
+						                 ErrorReason::InvalidBracketing, parse_state );
+						closers.pop_back( );
+						if constexpr( OutputPolicy::output_trailing_comma ==
+						              options::OutputTrailingComma::Yes ) {
+							out_it.put( ',' );
+						}
+						out_it.del_indent( );
+						out_it.next_member( );
+						out_it.put( next );
+						parse_state.trim_left_checked( );
+					}
+					if( closers.empty( ) ) {
+						return;
+					}
+				}
+			}
+		} // namespace json_details
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -82,6 +82,17 @@ namespace daw::json {
 			inline constexpr auto
 			  default_json_option_value<options::OutputTrailingComma> =
 			    options::OutputTrailingComma::No;
+
+			template<>
+			inline constexpr bool is_output_option_v<options::RawValueFormat> = true;
+
+			template<>
+			inline constexpr unsigned
+			  json_option_bits_width<options::RawValueFormat> = 1;
+
+			template<>
+			inline constexpr auto default_json_option_value<options::RawValueFormat> =
+			  options::RawValueFormat::Verbatim;
 		} // namespace json_details
 	}   // namespace DAW_JSON_VER
 } // namespace daw::json
@@ -89,6 +89,10 @@ namespace daw::json {
 			  json_details::serialization::get_bits_for<options::OutputTrailingComma>(
 			    PolicyFlags );
 
+			static constexpr options::RawValueFormat raw_value_format =
+			  json_details::serialization::get_bits_for<options::RawValueFormat>(
+			    PolicyFlags );
+
 			DAW_ATTRIB_INLINE constexpr void add_indent( ) {
 				if constexpr( serialization_format !=
 				              options::SerializationFormat::Minified ) {
@@ -103,22 +107,30 @@ namespace daw::json {
 				}
 			}
 
+			using newline_indent_t =
+			  json_details::serialization::newline_indent<serialization_format,
+			                                              indentation_type,
+			                                              newline_delimiter>;
+
 			inline constexpr void output_indent( ) {
 				if constexpr( serialization_format !=
 				              options::SerializationFormat::Minified ) {
-					constexpr std::string_view indent =
-					  json_details::serialization::generate_indent<serialization_format,
-					                                               indentation_type>;
-					if( not indent.empty( ) ) {
-						for( std::size_t n = 0; n < indentation_level; ++n ) {
-							write_output( *m_writable, indent );
+					if constexpr( not newline_indent_t::indent.empty( ) ) {
+						// Write the whole indentation at once, in max_levels sized pieces
+						// when it is deeper than that
+						auto level = indentation_level;
+						while( level > newline_indent_t::max_levels ) {
+							write_output( *m_writable, newline_indent_t::indentation(
+							                             newline_indent_t::max_levels ) );
+							level -= newline_indent_t::max_levels;
 						}
+						write_output( *m_writable,
+						              newline_indent_t::indentation( level ) );
 					}
 				}
 			}
 
-			static constexpr std::string_view newline =
-			  newline_delimiter == options::NewLineDelimiter::n ? "\n" : "\r\n";
+			static constexpr std::string_view newline = newline_indent_t::newline;
 
 			DAW_ATTRIB_INLINE constexpr void output_newline( ) {
 				if constexpr( serialization_format !=
@@ -133,8 +145,49 @@ namespace daw::json {
 			    : nullptr;
 
 			DAW_ATTRIB_INLINE constexpr void next_member( ) {
-				output_newline( );
-				output_indent( );
+				if constexpr( serialization_format !=
+				              options::SerializationFormat::Minified ) {
+					if( indentation_level <= newline_indent_t::max_levels ) {
+						write_output( *m_writable,
+						              newline_indent_t::prefix( indentation_level ) );
+					} else {
+						output_newline( );
+						output_indent( );
+					}
+				}
+			}
+
+			/***
+			 * @brief Start the class member JsonMember: the ',' separator unless it
+			 * is the first member, the newline and indentation, and the quoted name
+			 * followed by ':'.  The separator and name are a precomputed literal
+			 * per member, they are passed to the output in one write
+			 */
+			template<typename JsonMember>
+			DAW_ATTRIB_INLINE constexpr void member_name( bool is_first ) {
+				using name_t =
+				  json_details::serialization::quoted_member_name<JsonMember,
+				                                                  serialization_format>;
+				if constexpr( serialization_format ==
+				              options::SerializationFormat::Minified ) {
+					write_output( *m_writable,
+					              is_first ? name_t::value : name_t::separated_value );
+				} else {
+					if( indentation_level <= newline_indent_t::max_levels ) {
+						write_output(
+						  *m_writable,
+						  is_first
+						    ? newline_indent_t::prefix( indentation_level )
+						    : newline_indent_t::separated_prefix( indentation_level ),
+						  name_t::value );
+					} else {
+						if( not is_first ) {
+							put( ',' );
+						}
+						next_member( );
+						write_output( *m_writable, name_t::value );
+					}
+				}
 			}
 
 			template<typename... ContiguousCharRanges>
@@ -14,8 +14,10 @@
 #include "daw_json_parse_options_impl.h"
 #include "daw_json_serialize_options_impl.h"
 
+#include <array>
 #include <cstddef>
 #include <iterator>
+#include <string_view>
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
@@ -164,7 +166,7 @@ namespace daw::json {
 			using policy_list = typename option_list_impl<
 			  options::SerializationFormat, options::IndentationType,
 			  options::RestrictedStringOutput, options::NewLineDelimiter,
-			  options::OutputTrailingComma>::type;
+			  options::OutputTrailingComma, options::RawValueFormat>::type;
 
 			template<typename Policy, typename Policies>
 			inline constexpr unsigned basic_policy_bits_start =
@@ -289,6 +291,102 @@ namespace daw::json {
 			inline constexpr std::string_view
 			  generate_indent<options::SerializationFormat::Pretty,
 			                  options::IndentationType::Space10> = "          ";
+
+			/***
+			 * @brief A ',' and a newline followed by max_levels levels of
+			 * indentation.  The prefix for any level up to max_levels, with or
+			 * without the ',', is a view into it, so that it can be written as one
+			 * range
+			 */
+			template<options::SerializationFormat Format,
+			         options::IndentationType Indentation,
+			         options::NewLineDelimiter NewLine>
+			struct newline_indent {
+				static constexpr std::string_view newline =
+				  NewLine == options::NewLineDelimiter::n ? "\n" : "\r\n";
+				static constexpr std::string_view indent =
+				  generate_indent<Format, Indentation>;
+				static constexpr std::size_t max_levels = 32;
+
+			private:
+				static constexpr std::size_t buffer_size =
+				  1 + newline.size( ) + indent.size( ) * max_levels;
+
+				static constexpr std::array<char, buffer_size> buffer = [] {
+					auto result = std::array<char, buffer_size>{ };
+					std::size_t pos = 0;
+					result[pos++] = ',';
+					for( char c : newline ) {
+						result[pos++] = c;
+					}
+					for( std::size_t n = 0; n < max_levels; ++n ) {
+						for( char c : indent ) {
+							result[pos++] = c;
+						}
+					}
+					return result;
+				}( );
+
+			public:
+				/// @brief The newline and indentation for level, up to max_levels
+				static constexpr std::string_view prefix( std::size_t level ) {
+					return std::string_view( buffer.data( ) + 1,
+					                         newline.size( ) + indent.size( ) * level );
+				}
+
+				/// @brief A ',' followed by prefix( level )
+				static constexpr std::string_view
+				separated_prefix( std::size_t level ) {
+					return std::string_view( buffer.data( ),
+					                         1 + newline.size( ) +
+					                           indent.size( ) * level );
+				}
+
+				/// @brief The indentation for level, up to max_levels
+				static constexpr std::string_view indentation( std::size_t level ) {
+					return std::string_view( buffer.data( ) + 1 + newline.size( ),
+					                         indent.size( ) * level );
+				}
+			};
+
+			/***
+			 * @brief The name of JsonMember as it is output, ',"name":' followed by
+			 * a space when the output is not minified.  Names are output as is, they
+			 * are not escaped
+			 */
+			template<typename JsonMember, options::SerializationFormat Format>
+			struct quoted_member_name {
+			private:
+				static constexpr bool has_space =
+				  Format != options::SerializationFormat::Minified;
+				static constexpr std::size_t buffer_size =
+				  JsonMember::name.size( ) + ( has_space ? 5 : 4 );
+
+				static constexpr std::array<char, buffer_size> buffer = [] {
+					auto result = std::array<char, buffer_size>{ };
+					std::size_t pos = 0;
+					result[pos++] = ',';
+					result[pos++] = '"';
+					for( char c : JsonMember::name ) {
+						result[pos++] = c;
+					}
+					result[pos++] = '"';
+					result[pos++] = ':';
+					if( has_space ) {
+						result[pos++] = ' ';
+					}
+					return result;
+				}( );
+
+			public:
+				/// @brief '"name":' and the space
+				static constexpr std::string_view value =
+				  std::string_view( buffer.data( ) + 1, buffer_size - 1 );
+
+				/// @brief ',' followed by value
+				static constexpr std::string_view separated_value =
+				  std::string_view( buffer.data( ), buffer_size );
+			};
 		} // namespace json_details::serialization
 	}   // namespace DAW_JSON_VER
 } // namespace daw::json
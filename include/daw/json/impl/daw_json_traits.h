@@ -203,6 +203,16 @@ namespace daw::json {
 			inline constexpr bool is_a_json_tagged_variant_v =
 			  daw::is_detected_v<is_a_json_tagged_variant_test, T>;
 
+			template<typename T>
+			using is_a_json_deferred_test = typename T::i_am_a_json_deferred;
+
+			/// @brief Types, like basic_json_deferred, that json_raw constructs from
+			/// the whole value, including the quotes of strings, and the number of
+			/// elements/members of an array/class
+			template<typename T>
+			inline constexpr bool is_a_json_deferred_v =
+			  daw::is_detected_v<is_a_json_deferred_test, T>;
+
 			template<typename T>
 			using json_class_constructor_t_impl =
 			  typename json_data_contract<T>::constructor;
@@ -13,6 +13,7 @@
 #include "../daw_json_data_contract.h"
 #include "daw_json_assert.h"
 #include "daw_json_parse_iso8601_utils.h"
+#include "daw_json_reformat_impl.h"
 #include "daw_json_serialize_options_impl.h"
 #include "daw_json_serialize_policy.h"
 #include "daw_json_value.h"
@@ -293,6 +294,80 @@ namespace daw::json {
 		} // namespace json_details
 
 		namespace utils {
+			template<typename T>
+			using char_data_test = std::enable_if_t<std::is_same_v<
+			  DAW_TYPEOF( *std::data( std::declval<T const &>( ) ) ), char>>;
+
+			template<typename T>
+			inline constexpr bool is_contiguous_char_range_v =
+			  daw::is_detected_v<char_data_test, T> and
+			  json_details::is_string_view_like_v<T const &>;
+
+			/// @brief Is c output unchanged in a JSON string.  Unless restrict_high,
+			/// the bytes of multi-byte UTF-8 sequences are too
+			template<bool restrict_high>
+			DAW_ATTRIB_INLINE constexpr bool is_unescaped_char( char c ) {
+				auto const u = static_cast<unsigned char>( c );
+				if constexpr( restrict_high ) {
+					return u >= 0x20U and u < 0x7FU and c != '"' and c != '\\';
+				} else {
+					return u >= 0x20U and c != '"' and c != '\\';
+				}
+			}
+
+			/// @brief Output the code point cp of a string, escaping it if needed
+			template<bool restrict_high, typename WritableType>
+			[[nodiscard]] static constexpr WritableType
+			escape_code_point( WritableType it, std::uint32_t cp ) {
+				switch( cp ) {
+				case '"':
+					it.write( "\\\"" );
+					break;
+				case '\\':
+					it.write( "\\\\" );
+					break;
+				case '\b':
+					it.write( "\\b" );
+					break;
+				case '\f':
+					it.write( "\\f" );
+					break;
+				case '\n':
+					it.write( "\\n" );
+					break;
+				case '\r':
+					it.write( "\\r" );
+					break;
+				case '\t':
+					it.write( "\\t" );
+					break;
+				default:
+					if( cp < 0x20U ) {
+						it = json_details::output_hex( static_cast<std::uint16_t>( cp ),
+						                               it );
+						break;
+					}
+					if constexpr( restrict_high ) {
+						if( cp >= 0x7FU and cp <= 0xFFFFU ) {
+							it = json_details::output_hex(
+							  static_cast<std::uint16_t>( cp ), it );
+							break;
+						}
+						if( cp > 0xFFFFU ) {
+							it = json_details::output_hex(
+							  static_cast<std::uint16_t>( 0xD7C0U + ( cp >> 10U ) ), it );
+							it = json_details::output_hex(
+							  static_cast<std::uint16_t>( 0xDC00U + ( cp & 0x3FFU ) ),
+							  it );
+							break;
+						}
+					}
+					json_details::utf32_to_utf8( cp, it );
+					break;
+				}
+				return it;
+			}
+
 			template<
 			  bool do_escape = false,
 			  options::EightBitModes EightBitMode = options::EightBitModes::AllowFull,
@@ -307,57 +382,33 @@ namespace daw::json {
 				  ( WritableType::restricted_string_output ==
 				    options::RestrictedStringOutput::OnlyAllow7bitsStrings );
 				if constexpr( do_escape ) {
-					using iter = DAW_TYPEOF( std::begin( container ) );
-					using it_t = utf8::unchecked::iterator<iter>;
-					auto first = it_t( std::begin( container ) );
-					auto const last = it_t( std::end( container ) );
-					while( first != last ) {
-						auto const cp = *first++;
-						switch( cp ) {
-						case '"':
-							it.write( "\\\"" );
-							break;
-						case '\\':
-							it.write( "\\\\" );
-							break;
-						case '\b':
-							it.write( "\\b" );
-							break;
-						case '\f':
-							it.write( "\\f" );
-							break;
-						case '\n':
-							it.write( "\\n" );
-							break;
-						case '\r':
-							it.write( "\\r" );
-							break;
-						case '\t':
-							it.write( "\\t" );
-							break;
-						default:
-							if( cp < 0x20U ) {
-								it = json_details::output_hex( static_cast<std::uint16_t>( cp ),
-								                               it );
-								break;
+					if constexpr( is_contiguous_char_range_v<Container> ) {
+						// Runs of characters that are output as is are copied as one
+						// range
+						char const *ptr = std::data( container );
+						char const *const last = ptr + std::size( container );
+						while( ptr < last ) {
+							char const *run_last = ptr;
+							while( run_last != last and
+							       is_unescaped_char<restrict_high>( *run_last ) ) {
+								++run_last;
 							}
-							if constexpr( restrict_high ) {
-								if( cp >= 0x7FU and cp <= 0xFFFFU ) {
-									it = json_details::output_hex(
-									  static_cast<std::uint16_t>( cp ), it );
-									break;
-								}
-								if( cp > 0xFFFFU ) {
-									it = json_details::output_hex(
-									  static_cast<std::uint16_t>( 0xD7C0U + ( cp >> 10U ) ), it );
-									it = json_details::output_hex(
-									  static_cast<std::uint16_t>( 0xDC00U + ( cp & 0x3FFU ) ),
-									  it );
-									break;
-								}
+							if( run_last != ptr ) {
+								it.copy_buffer( ptr, run_last );
+								ptr = run_last;
+								continue;
 							}
-							json_details::utf32_to_utf8( cp, it );
-							break;
+							auto cp_it = utf8::unchecked::iterator<char const *>( ptr );
+							it = escape_code_point<restrict_high>( it, *cp_it++ );
+							ptr = cp_it.base( );
+						}
+					} else {
+						using iter = DAW_TYPEOF( std::begin( container ) );
+						using it_t = utf8::unchecked::iterator<iter>;
+						auto first = it_t( std::begin( container ) );
+						auto const last = it_t( std::end( container ) );
+						while( first != last ) {
+							it = escape_code_point<restrict_high>( it, *first++ );
 						}
 					}
 				} else {
@@ -886,8 +937,17 @@ namespace daw::json {
 					it.write( "null" );
 					return it;
 				}
-				it.put( '"' );
 				datetime::ymdhms const civil = datetime::time_point_to_civil( value );
+				if( DAW_LIKELY( civil.year >= 0 and civil.year <= 9999 ) ) {
+					char buff[datetime::datetime_details::iso8601_fixed_max_size + 2]{ };
+					buff[0] = '"';
+					std::size_t const sz =
+					  datetime::datetime_details::format_iso8601_fixed( civil, buff + 1 );
+					buff[sz + 1] = '"';
+					it.write( daw::string_view( buff, sz + 2 ) );
+					return it;
+				}
+				it.put( '"' );
 				it = utils::integer_to_string( it, civil.year );
 				it.put( '-' );
 				if( civil.month < 10 ) {
@@ -916,17 +976,83 @@ namespace daw::json {
 				it = utils::integer_to_string( it, civil.second );
 				if( civil.millisecond > 0 ) {
 					it.put( '.' );
+					if( civil.millisecond < 100 ) {
+						it.put( '0' );
+					}
+					if( civil.millisecond < 10 ) {
+						it.put( '0' );
+					}
 					it = utils::integer_to_string( it, civil.millisecond );
 				}
 				it.write( "Z\"" );
 				return it;
 			}
 
+			template<typename T>
+			using contiguous_raw_json_test =
+			  decltype( daw::string_view( std::data( std::declval<T const &>( ) ),
+			                              std::size( std::declval<T const &>( ) ) ) );
+
+			template<typename T>
+			using pointer_range_raw_json_test = std::enable_if_t<std::is_same_v<
+			  DAW_TYPEOF( std::begin( std::declval<T const &>( ) ) ), char const *>>;
+
+			/// @brief Can the JSON text of a raw value be referred to as one range
+			template<typename T>
+			inline constexpr bool is_contiguous_raw_json_v =
+			  is_a_basic_json_value<T> or
+			  daw::is_detected_v<contiguous_raw_json_test, T> or
+			  daw::is_detected_v<pointer_range_raw_json_test, T>;
+
+			/// @brief The JSON text of a raw value.  Strings held by a
+			/// basic_json_value include their quotes
+			template<typename T>
+			[[nodiscard]] constexpr daw::string_view raw_json_text( T const &value ) {
+				if constexpr( is_a_basic_json_value<T> ) {
+					if( value.is_null( ) ) {
+						return daw::string_view( "null" );
+					}
+					auto const state = value.get_state( );
+					return daw::string_view( std::data( state ), std::size( state ) );
+				} else if constexpr( daw::is_detected_v<contiguous_raw_json_test, T> ) {
+					return daw::string_view( std::data( value ), std::size( value ) );
+				} else {
+					char const *const first = std::begin( value );
+					return daw::string_view(
+					  first,
+					  static_cast<std::size_t>( std::end( value ) - first ) );
+				}
+			}
+
 			template<typename JsonMember, typename WriteableType, typename parse_to_t>
 			[[nodiscard]] static inline constexpr WriteableType
 			to_json_string_unknown( WriteableType it, parse_to_t const &value ) {
-
-				return utils::copy_to_iterator( it, value );
+				constexpr bool check_each_char =
+				  WriteableType::restricted_string_output ==
+				  options::RestrictedStringOutput::OnlyAllow7bitsStrings;
+				if constexpr( not is_contiguous_raw_json_v<parse_to_t> ) {
+					return utils::copy_to_iterator( it, value );
+				} else {
+					// The raw text is copied as one range, it is never decoded
+					auto const raw = raw_json_text( value );
+					if constexpr( check_each_char ) {
+						// Checked before anything is written so that no partial value is
+						// output
+						for( char const c : raw ) {
+							daw_json_ensure( static_cast<unsigned char>( c ) <= 0x7FU,
+							                 ErrorReason::InvalidStringHighASCII );
+						}
+					}
+					if constexpr( WriteableType::raw_value_format ==
+					              options::RawValueFormat::Reformat ) {
+						auto parse_state =
+						  DefaultParsePolicy( raw.data( ), raw.data( ) + raw.size( ) );
+						reformat_json( parse_state, it );
+					} else {
+						it.copy_buffer( raw.data( ), raw.data( ) + raw.size( ) );
+					}
+					return it;
+				}
 			}
 
 			template<typename JsonMember, typename WriteableType, typename parse_to_t>
@@ -977,6 +1103,10 @@ namespace daw::json {
 					}
 					it.put( '"' );
 					return it;
+				} else if constexpr( std::is_invocable_r_v<
+				                       WriteableType, typename JsonMember::to_converter_t,
+				                       WriteableType, parse_to_t> ) {
+					return typename JsonMember::to_converter_t{ }( it, value );
 				} else {
 					return utils::copy_to_iterator(
 					  it, typename JsonMember::to_converter_t{ }( value ) );
@@ -1157,17 +1287,14 @@ namespace daw::json {
 					it.next_member( );
 					it.put( '{' );
 					it.add_indent( );
-					it.next_member( );
 					// Append Key Name
-					it.write( "\"", key_t::name, "\":", it.space );
+					it.template member_name<key_t>( true );
 					// Append Key Value
 					it = to_daw_json_string<key_t>( ParseTag<key_t::expected_type>{ }, it,
 					                                json_get_key( *first ) );
 
-					it.put( ',' );
 					// Append Value Name
-					it.next_member( );
-					it.write( "\"", value_t::name, "\":", it.space );
+					it.template member_name<value_t>( false );
 					// Append Value Value
 					it = to_daw_json_string<value_t>( ParseTag<value_t::expected_type>{ },
 					                                  it, json_get_value( *first ) );
@@ -1382,12 +1509,8 @@ namespace daw::json {
 						return;
 					}
 					visited_members.push_back( dependent_member::name );
-					if( not is_first ) {
-						it.put( ',' );
-					}
-					it.next_member( );
+					it.template member_name<dependent_member>( is_first );
 					is_first = false;
-					it.write( '"', dependent_member::name, "\":", it.space );
 
 					if constexpr( has_switcher_v<base_member_t> ) {
 						it = member_to_string( template_arg<dependent_member>, it,
@@ -1423,12 +1546,8 @@ namespace daw::json {
 						return;
 					}
 				}
-				if( not is_first ) {
-					it.put( ',' );
-				}
-				it.next_member( );
+				it.template member_name<JsonMember>( is_first );
 				is_first = false;
-				it.write( '"', JsonMember::name, "\":", it.space );
 
 				it = member_to_string( template_arg<JsonMember>, DAW_MOVE( it ),
 				                       get<pos>( tp ) );
@@ -0,0 +1,145 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Helpers shared by the benchmark drivers that record bench_result's, e.g.
+// json_benchmark and json_alloc_bench.  The build system describes the
+// build and machine with the macros below, so the helpers are local to each
+// driver
+//
+
+#pragma once
+
+#include "bench_result.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/daw_read_file.h>
+#include <daw/daw_utility.h>
+#include <daw/json/daw_from_json.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <ios>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// These come from build system and must be defined
+#ifndef SOURCE_CONTROL_REVISION
+#error "SOURCE_CONTROL_REVSION must be defined"
+#endif
+#ifndef PROCESSOR_DESCRIPTION
+#error "PROCESSOR_DESCRIPTION must be defined"
+#endif
+#ifndef OS_NAME
+#error "OS_NAME must be defined"
+#endif
+#ifndef OS_RELEASE
+#error "OS_RELEASE must be defined"
+#endif
+#ifndef OS_VERSION
+#error "OS_VERSION must be defined"
+#endif
+#ifndef OS_PLATFORM
+#error "OS_PLATFORM must be defined"
+#endif
+#ifndef BUILD_TYPE
+#error "BUILD_TYPE must be defined"
+#endif
+
+inline namespace {
+	/// A result of the daw_json_link project_subname benchmark, timestamped
+	/// now and describing this build
+	daw::bench::bench_result
+	make_bench_result( std::string const &name, std::size_t data_size,
+	                   std::vector<std::chrono::nanoseconds> run_times,
+	                   std::string const &project_subname ) {
+		return { name,
+		         std::chrono::time_point_cast<std::chrono::milliseconds>(
+		           std::chrono::system_clock::now( ) ),
+		         data_size,
+		         std::move( run_times ),
+		         { },
+		         { },
+		         { },
+		         { },
+		         { },
+		         SOURCE_CONTROL_REVISION,
+		         PROCESSOR_DESCRIPTION,
+		         OS_NAME,
+		         OS_RELEASE,
+		         OS_VERSION,
+		         OS_PLATFORM,
+		         BUILD_TYPE,
+		         "daw_json_link",
+		         project_subname,
+		         { } };
+	}
+
+	std::ostream &operator<<( std::ostream &os, std::chrono::nanoseconds t ) {
+		auto const ae = daw::on_scope_exit(
+		  [&os, old_flags = std::ios_base::fmtflags( os.flags( ) )] {
+			  os.flags( old_flags );
+		  } );
+
+		os << std::setprecision( static_cast<int>( 2 ) ) << std::fixed;
+		auto val = static_cast<double>( t.count( ) );
+		if( val < 1000 ) {
+			os << val << "ns";
+			return os;
+		}
+		val /= 1000.0;
+		if( val < 1000 ) {
+			os << val << "us";
+			return os;
+		}
+		val /= 1000.0;
+		if( val < 1000 ) {
+			os << val << "ms";
+			return os;
+		}
+		val /= 1000.0;
+		os << val << "s";
+		return os;
+	}
+
+	constexpr double to_fract( std::chrono::nanoseconds ns ) {
+		using dest_t = std::chrono::duration<double>;
+		return std::chrono::duration_cast<dest_t>( ns ).count( );
+	}
+
+	/// Percentiles of the run times and the median throughput
+	void process_results( daw::bench::bench_result &jr ) {
+		auto runs = jr.run_times;
+		std::sort( runs.begin( ), runs.end( ) );
+		auto const percentile = [&]( std::size_t p ) {
+			return runs[( ( runs.size( ) - 1U ) * p ) / 100U];
+		};
+		jr.duration_min = runs.front( );
+		jr.duration_max = runs.back( );
+		jr.duration_25th_percentile = percentile( 25 );
+		jr.duration_50th_percentile = percentile( 50 );
+		jr.duration_75th_percentile = percentile( 75 );
+		auto const median_seconds = to_fract( jr.duration_50th_percentile );
+		if( median_seconds > 0.0 ) {
+			jr.throughput_mb_per_second =
+			  static_cast<double>( jr.data_size ) / median_seconds / 1'000'000.0;
+		}
+	}
+
+	/// The results stored in file_name, none when it is missing or empty
+	std::vector<daw::bench::bench_result>
+	read_results_file( std::string const &file_name ) {
+		auto const json_data = daw::read_file( file_name );
+		if( not json_data or json_data->size( ) < 2U ) {
+			return { };
+		}
+		return daw::json::from_json_array<daw::bench::bench_result>( *json_data );
+	}
+} // namespace
@@ -12,6 +12,7 @@
 
 #include <chrono>
 #include <cstddef>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -38,6 +39,13 @@ namespace daw::bench {
 		std::string build_type;
 		std::string project_name;
 		std::string project_subname;
+		// Median throughput in MB/s, missing in older results
+		std::optional<double> throughput_mb_per_second{ };
+		// Heap allocations and bytes allocated per run, and the most bytes live
+		// at once during a run.  Only recorded by json_alloc_bench
+		std::optional<double> allocations_per_document{ };
+		std::optional<double> bytes_allocated_per_document{ };
+		std::optional<std::size_t> peak_live_bytes{ };
 	};
 } // namespace daw::bench
 
@@ -87,6 +95,13 @@ namespace daw::json {
 		static inline constexpr char const build_type[] = "build_type";
 		static inline constexpr char const project_name[] = "project_name";
 		static inline constexpr char const project_subname[] = "project_subname";
+		static inline constexpr char const throughput_mb_per_second[] =
+		  "throughput_mb_per_second";
+		static inline constexpr char const allocations_per_document[] =
+		  "allocations_per_document";
+		static inline constexpr char const bytes_allocated_per_document[] =
+		  "bytes_allocated_per_document";
+		static inline constexpr char const peak_live_bytes[] = "peak_live_bytes";
 		using type = json_member_list<
 		  json_string<name>, json_date<test_time>,
 		  json_number<data_size, std::size_t>,
@@ -97,7 +112,11 @@ namespace daw::json {
 		  json_string<git_revision>, json_string<processor_description>,
 		  json_string<os_name>, json_string<os_release>, json_string<os_version>,
 		  json_string<os_platform>, json_string<build_type>,
-		  json_string<project_name>, json_string<project_subname>>;
+		  json_string<project_name>, json_string<project_subname>,
+		  json_number_null<throughput_mb_per_second, std::optional<double>>,
+		  json_number_null<allocations_per_document, std::optional<double>>,
+		  json_number_null<bytes_allocated_per_document, std::optional<double>>,
+		  json_number_null<peak_live_bytes, std::optional<std::size_t>>>;
 
 		[[nodiscard]] static inline auto
 		to_json_data( daw::bench::bench_result const &value ) {
@@ -107,7 +126,9 @@ namespace daw::json {
 			  value.duration_50th_percentile, value.duration_75th_percentile,
 			  value.duration_max, value.git_revision, value.processor_description,
 			  value.os_name, value.os_release, value.os_version, value.os_platform,
-			  value.build_type, value.project_name, value.project_subname );
+			  value.build_type, value.project_name, value.project_subname,
+			  value.throughput_mb_per_second, value.allocations_per_document,
+			  value.bytes_allocated_per_document, value.peak_live_bytes );
 		}
 	};
 } // namespace daw::json
@@ -0,0 +1,132 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include <daw/daw_check_exceptions.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace daw {
+	/// @brief A snapshot of alloc_counters
+	struct alloc_stats {
+		std::size_t allocations = 0;
+		std::size_t bytes = 0;
+		std::size_t live_bytes = 0;
+		std::size_t peak_live_bytes = 0;
+	};
+
+	/***
+	 * @brief Counts allocations, the bytes allocated, and the bytes currently
+	 * and at most allocated.  Safe to use from multiple threads and during
+	 * static initialization
+	 */
+	class alloc_counters {
+		std::atomic<std::size_t> m_allocations{ 0 };
+		std::atomic<std::size_t> m_bytes{ 0 };
+		std::atomic<std::size_t> m_live_bytes{ 0 };
+		std::atomic<std::size_t> m_peak_live_bytes{ 0 };
+
+	public:
+		constexpr alloc_counters( ) = default;
+
+		alloc_counters( alloc_counters const & ) = delete;
+		alloc_counters &operator=( alloc_counters const & ) = delete;
+
+		void on_allocate( std::size_t size ) noexcept {
+			m_allocations.fetch_add( 1, std::memory_order_relaxed );
+			m_bytes.fetch_add( size, std::memory_order_relaxed );
+			auto const live =
+			  m_live_bytes.fetch_add( size, std::memory_order_relaxed ) + size;
+			auto peak = m_peak_live_bytes.load( std::memory_order_relaxed );
+			while( peak < live and
+			       not m_peak_live_bytes.compare_exchange_weak(
+			         peak, live, std::memory_order_relaxed ) ) {}
+		}
+
+		void on_deallocate( std::size_t size ) noexcept {
+			m_live_bytes.fetch_sub( size, std::memory_order_relaxed );
+		}
+
+		/// @brief Start measuring a new peak from the bytes currently allocated
+		void reset_peak( ) noexcept {
+			m_peak_live_bytes.store( m_live_bytes.load( std::memory_order_relaxed ),
+			                         std::memory_order_relaxed );
+		}
+
+		[[nodiscard]] alloc_stats snapshot( ) const noexcept {
+			return { m_allocations.load( std::memory_order_relaxed ),
+			         m_bytes.load( std::memory_order_relaxed ),
+			         m_live_bytes.load( std::memory_order_relaxed ),
+			         m_peak_live_bytes.load( std::memory_order_relaxed ) };
+		}
+	};
+
+	/***
+	 * @brief An allocator that counts what it allocates in an alloc_counters and
+	 * gets the memory from std::malloc.  It does not go through operator new,
+	 * so a replaced global operator new does not count its allocations a second
+	 * time.  Copies and rebinds share the counters, which must outlive them
+	 */
+	template<typename T>
+	class counting_allocator {
+		alloc_counters *m_counters;
+
+		template<typename>
+		friend class counting_allocator;
+
+	public:
+		using value_type = T;
+
+		explicit constexpr counting_allocator( alloc_counters &counters ) noexcept
+		  : m_counters( &counters ) {}
+
+		template<typename U>
+		constexpr counting_allocator( counting_allocator<U> const &other ) noexcept
+		  : m_counters( other.m_counters ) {}
+
+		[[nodiscard]] T *allocate( std::size_t n ) {
+			static_assert( alignof( T ) <= alignof( std::max_align_t ),
+			               "Over aligned types are not supported" );
+			void *result = std::malloc( n * sizeof( T ) );
+			if( not result ) {
+#if defined( DAW_USE_EXCEPTIONS )
+				throw std::bad_alloc( );
+#else
+				std::abort( );
+#endif
+			}
+			m_counters->on_allocate( n * sizeof( T ) );
+			return static_cast<T *>( result );
+		}
+
+		void deallocate( T *p, std::size_t n ) noexcept {
+			m_counters->on_deallocate( n * sizeof( T ) );
+			std::free( p );
+		}
+
+		[[nodiscard]] alloc_counters &counters( ) const noexcept {
+			return *m_counters;
+		}
+
+		template<typename U>
+		[[nodiscard]] constexpr bool
+		operator==( counting_allocator<U> const &rhs ) const noexcept {
+			return m_counters == rhs.m_counters;
+		}
+
+		template<typename U>
+		[[nodiscard]] constexpr bool
+		operator!=( counting_allocator<U> const &rhs ) const noexcept {
+			return m_counters != rhs.m_counters;
+		}
+	};
+} // namespace daw
@@ -90,6 +90,34 @@ int main( int argc, char **argv )
 		  canada_result );
 	}
 	test_assert( not str.empty( ), "Expected a string value" );
+	// canada.json is almost all doubles, the worst case for to_json_exact as
+	// its size pass formats every double a second time.  Compare it to a
+	// to_json that grows a new string
+	{
+		(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  "canada bench(to_json - growing string)", sz,
+		  [&]( auto const &tr ) {
+			  auto result = daw::json::to_json( tr );
+			  daw::do_not_optimize( result );
+		  },
+		  canada_result );
+		(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  "canada bench(to_json_size - size pass only)", sz,
+		  [&]( auto const &tr ) {
+			  auto result = daw::json::to_json_size( tr );
+			  daw::do_not_optimize( result );
+		  },
+		  canada_result );
+		(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  "canada bench(to_json_exact - size pass and exact string)", sz,
+		  [&]( auto const &tr ) {
+			  auto result = daw::json::to_json_exact( tr );
+			  daw::do_not_optimize( result );
+		  },
+		  canada_result );
+	}
+	test_assert( daw::json::to_json_exact( canada_result ) == str,
+	             "Expected to_json_exact to match to_json" );
 	daw::do_not_optimize( str );
 	auto canada_result2 = get_canada_check( str );
 	daw::do_not_optimize( canada_result2 );
@@ -74,6 +74,19 @@ int main( int argc, char **argv )
 	auto const cls2 = daw::json::from_json<daw::cookbook_dates1::MyClass1>( str );
 
 	test_assert( cls == cls2, "Unexpected round trip error" );
+
+	auto const cls3 = daw::cookbook_dates1::MyClass1{
+	  "Epoch", std::chrono::time_point<std::chrono::system_clock,
+	                                   std::chrono::milliseconds>(
+	             std::chrono::milliseconds( 5 ) ) };
+	std::string const str3 = daw::json::to_json( cls3 );
+	puts( str3.c_str( ) );
+	test_assert( str3 ==
+	               R"({"name":"Epoch","timestamp":"1970-01-01T00:00:00.005Z"})",
+	             "Unexpected serialization" );
+	test_assert( daw::json::from_json<daw::cookbook_dates1::MyClass1>( str3 ) ==
+	               cls3,
+	             "Unexpected round trip error" );
 }
 #ifdef DAW_USE_EXCEPTIONS
 catch( daw::json::json_exception const &jex ) {
@@ -0,0 +1,192 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// See cookbook/enums.md for the 3rd example
+//
+
+#include "defines.h"
+
+#include "daw/json/daw_json_link.h"
+
+#include <daw/daw_read_file.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace daw::cookbook_enums3 {
+	enum class Colours : uint8_t { red, green, blue, black };
+
+	// Sparse values are serialized with a search instead of a direct index
+	enum class Status : int { failed = -100, ok = 200, moved = 301 };
+
+	struct StatusNames {
+		static constexpr daw::json::json_enum_entry<Status> values[] = {
+		  { Status::failed, "failed" },
+		  { Status::ok, "ok" },
+		  { Status::moved, "moved" },
+		  { Status::ok, "success" } };
+	};
+
+	struct MyClass1 {
+		std::vector<Colours> member0;
+	};
+
+	bool operator==( MyClass1 const &lhs, MyClass1 const &rhs ) {
+		return lhs.member0 == rhs.member0;
+	}
+
+	struct MyClass2 {
+		Status status;
+		std::optional<Colours> colour;
+	};
+
+	bool operator==( MyClass2 const &lhs, MyClass2 const &rhs ) {
+		return lhs.status == rhs.status and lhs.colour == rhs.colour;
+	}
+} // namespace daw::cookbook_enums3
+
+namespace daw::json {
+	template<>
+	struct json_enum_names<daw::cookbook_enums3::Colours> {
+		using Colours = daw::cookbook_enums3::Colours;
+		static constexpr json_enum_entry<Colours> values[] = {
+		  { Colours::red, "red" },
+		  { Colours::green, "green" },
+		  { Colours::blue, "blue" },
+		  { Colours::black, "black" } };
+	};
+
+	template<>
+	struct json_data_contract<daw::cookbook_enums3::MyClass1> {
+#ifdef DAW_JSON_CNTTP_JSON_NAME
+		using type = json_member_list<
+		  json_array<"member0", json_enum_no_name<daw::cookbook_enums3::Colours>>>;
+#else
+		constexpr inline static char const member0[] = "member0";
+		using type = json_member_list<
+		  json_array<member0, json_enum_no_name<daw::cookbook_enums3::Colours>>>;
+#endif
+		static inline auto
+		to_json_data( daw::cookbook_enums3::MyClass1 const &value ) {
+			return std::forward_as_tuple( value.member0 );
+		}
+	};
+
+	template<>
+	struct json_data_contract<daw::cookbook_enums3::MyClass2> {
+#ifdef DAW_JSON_CNTTP_JSON_NAME
+		using type = json_member_list<
+		  json_enum<"status", daw::cookbook_enums3::Status,
+		            daw::cookbook_enums3::StatusNames>,
+		  json_enum_null<"colour",
+		                 std::optional<daw::cookbook_enums3::Colours>>>;
+#else
+		constexpr inline static char const status[] = "status";
+		constexpr inline static char const colour[] = "colour";
+		using type = json_member_list<
+		  json_enum<status, daw::cookbook_enums3::Status,
+		            daw::cookbook_enums3::StatusNames>,
+		  json_enum_null<colour, std::optional<daw::cookbook_enums3::Colours>>>;
+#endif
+		static inline auto
+		to_json_data( daw::cookbook_enums3::MyClass2 const &value ) {
+			return std::forward_as_tuple( value.status, value.colour );
+		}
+	};
+} // namespace daw::json
+
+namespace daw::cookbook_enums3 {
+	using colour_table_t = daw::json::json_details::enum_name_table<
+	  Colours, daw::json::json_enum_names<Colours>>;
+	static_assert( colour_table_t::is_dense );
+	static_assert( colour_table_t::find_name( "blue" ) == 2 );
+	static_assert( colour_table_t::find_name( "blu" ) ==
+	               daw::json::json_details::enum_npos );
+	static_assert( colour_table_t::name_of( Colours::black ) == "black" );
+
+	using status_table_t =
+	  daw::json::json_details::enum_name_table<Status, StatusNames>;
+	static_assert( not status_table_t::is_dense );
+	static_assert( status_table_t::parse( "success" ) == Status::ok );
+	static_assert( status_table_t::name_of( Status::ok ) == "ok" );
+	static_assert( status_table_t::find_value( static_cast<Status>( 0 ) ) ==
+	               daw::json::json_details::enum_npos );
+} // namespace daw::cookbook_enums3
+
+int main( int argc, char **argv )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	if( argc <= 1 ) {
+		puts( "Must supply path to cookbook_enums1.json file\n" );
+		exit( EXIT_FAILURE );
+	}
+	auto data = *daw::read_file( argv[1] );
+
+	auto const cls = daw::json::from_json<daw::cookbook_enums3::MyClass1>(
+	  std::string_view( data.data( ), data.size( ) ) );
+
+	test_assert( cls.member0[0] == daw::cookbook_enums3::Colours::red,
+	             "Unexpected value" );
+	test_assert( cls.member0[1] == daw::cookbook_enums3::Colours::green,
+	             "Unexpected value" );
+	test_assert( cls.member0[2] == daw::cookbook_enums3::Colours::blue,
+	             "Unexpected value" );
+	test_assert( cls.member0[3] == daw::cookbook_enums3::Colours::black,
+	             "Unexpected value" );
+	auto const str = daw::json::to_json( cls );
+	puts( str.c_str( ) );
+
+	auto const cls2 = daw::json::from_json<daw::cookbook_enums3::MyClass1>(
+	  std::string_view( str.data( ), str.size( ) ) );
+
+	test_assert( cls == cls2, "Unexpected round trip error" );
+
+	constexpr std::string_view json_str2 = R"({"status":"success"})";
+	auto const cls3 =
+	  daw::json::from_json<daw::cookbook_enums3::MyClass2>( json_str2 );
+	test_assert( cls3.status == daw::cookbook_enums3::Status::ok,
+	             "Unexpected value" );
+	test_assert( not cls3.colour, "Unexpected value" );
+
+	auto const cls4 = daw::cookbook_enums3::MyClass2{
+	  daw::cookbook_enums3::Status::failed, daw::cookbook_enums3::Colours::blue };
+	auto const str4 = daw::json::to_json( cls4 );
+	puts( str4.c_str( ) );
+	test_assert( str4 == R"({"status":"failed","colour":"blue"})",
+	             "Unexpected serialization" );
+	test_assert( daw::json::from_json<daw::cookbook_enums3::MyClass2>( str4 ) ==
+	               cls4,
+	             "Unexpected round trip error" );
+
+#ifdef DAW_USE_EXCEPTIONS
+	bool has_error = false;
+	try {
+		(void)daw::json::from_json<daw::cookbook_enums3::MyClass2>(
+		  std::string_view( R"({"status":"purple"})" ) );
+	} catch( daw::json::json_exception const & ) { has_error = true; }
+	test_assert( has_error, "Expected unknown enum name to be an error" );
+#endif
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -729,6 +729,38 @@ constexpr bool cxdbl_tostr2( ) {
 static_assert( cxdbl_tostr2( ) );
 #endif
 
+// The fixed layout fast path and the general timestamp parser must agree
+static_assert( daw::json::datetime::parse_iso8601_timestamp(
+                 daw::string_view( "2020-01-02T01:34:34.443Z" ) ) ==
+               daw::json::datetime::parse_iso8601_timestamp(
+                 daw::string_view( "20200102T013434.443Z" ) ) );
+static_assert( daw::json::datetime::parse_iso8601_timestamp(
+                 daw::string_view( "2020-01-02T02:34:34.443+01:00" ) ) ==
+               daw::json::datetime::parse_iso8601_timestamp(
+                 daw::string_view( "2020-01-02T01:34:34.443Z" ) ) );
+// 4 fractional digits are only handled by the general parser, both must
+// apply the whole offset
+static_assert( daw::json::datetime::parse_iso8601_timestamp(
+                 daw::string_view( "2020-01-02T10:00:00.1234+05:30" ) ) ==
+               daw::json::datetime::parse_iso8601_timestamp(
+                 daw::string_view( "2020-01-02T10:00:00.123+05:30" ) ) );
+static_assert( daw::json::datetime::parse_iso8601_timestamp(
+                 daw::string_view( "2020-01-02T10:00:00+05:30" ) ) ==
+               daw::json::datetime::parse_iso8601_timestamp(
+                 daw::string_view( "2020-01-02T04:30:00Z" ) ) );
+static_assert( daw::json::datetime::parse_iso8601_timestamp(
+                 daw::string_view( "2020-01-02T02:00:00.0001+0530" ) ) ==
+               daw::json::datetime::parse_iso8601_timestamp(
+                 daw::string_view( "2020-01-01T20:30:00Z" ) ) );
+static_assert( daw::json::datetime::parse_iso8601_timestamp(
+                 daw::string_view( "2020-01-01T23:00:00.0001-01:30" ) ) ==
+               daw::json::datetime::parse_iso8601_timestamp(
+                 daw::string_view( "2020-01-02T00:30:00Z" ) ) );
+static_assert( daw::json::datetime::parse_iso8601_timestamp(
+                 daw::string_view( "1969-12-31T23:59:59.999Z" ) )
+                 .time_since_epoch( )
+                 .count( ) == -1 );
+
 struct Foo1 {};
 
 struct Foo2 {
@@ -1043,6 +1075,17 @@ int main( int, char ** ) {
 		test_dblparse( "8725540998407961.3743556965848965343e-308", true );
 		test_dblparse( "1e-10000", true );
 		test_dblparse<false, true>( "0.9868011474609375", true );
+		// Values outside of the exact power10 range in precise mode
+		for( std::string_view num :
+		     { "1e23", "8.98846567431158e307", "1.7976931348623157e308",
+		       "2.2250738585072011e-308", "2.2250738585072014e-308",
+		       "4.9406564584124654e-324", "7.038531e-26", "9007199254740993",
+		       "9007199254740993e-3", "123456789012345678901234567890e-50",
+		       "0.1000000000000000055511151231257827021181583404541015625",
+		       "-1.2345678901234567e-250" } ) {
+			daw::expecting( test_dblparse<false, true>( num ) == 0 );
+			daw::expecting( test_dblparse<true, true>( num ) == 0 );
+		}
 		std::cout.precision( std::numeric_limits<double>::max_digits10 );
 #if defined( LDBL_MAX )
 		std::cout << "result: " << from_json<long double>( "1e-10000" ) << '\n';
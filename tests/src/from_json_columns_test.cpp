@@ -0,0 +1,116 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_from_json_columns.h>
+#include <daw/json/daw_json_link.h>
+
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+struct Row {
+	int id;
+	std::string name;
+	double score;
+	std::optional<int> parent;
+	bool active;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Row> {
+		static constexpr char const id[] = "id";
+		static constexpr char const name[] = "name";
+		static constexpr char const score[] = "score";
+		static constexpr char const parent[] = "parent";
+		static constexpr char const active[] = "active";
+		using type =
+		  json_member_list<json_link<id, int>, json_link<name, std::string>,
+		                   json_link<score, double>,
+		                   json_link<parent, std::optional<int>>,
+		                   json_link<active, bool>>;
+
+		static constexpr auto to_json_data( Row const &r ) {
+			return std::forward_as_tuple( r.id, r.name, r.score, r.parent,
+			                              r.active );
+		}
+	};
+} // namespace daw::json
+
+static_assert(
+  std::is_same_v<daw::json::json_columns<Row>::columns_t,
+                 std::tuple<std::vector<int>, daw::json::json_string_column,
+                            std::vector<double>,
+                            std::vector<std::optional<int>>, std::vector<bool>>> );
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	constexpr std::string_view json_data = R"json(
+[
+  {"id":1,"name":"first","score":1.5,"active":true},
+  {"name":"sec\"ond","id":2,"score":-2,"parent":1,"active":false},
+  {"id":3,"name":"","score":0.25,"parent":null,"active":true}
+]
+)json";
+
+	auto const cols = daw::json::from_json_columns<Row>( json_data );
+	ensure( cols.size( ) == 3 );
+
+	auto const &ids = cols.column<0>( );
+	ensure( ids == std::vector<int>{ 1, 2, 3 } );
+
+	auto const &names = cols.column<1>( );
+	ensure( names.size( ) == 3 );
+	ensure( names[0] == "first" );
+	ensure( names[1] == "sec\"ond" );
+	ensure( names[2].empty( ) );
+	ensure( names.chars( ) == "firstsec\"ond" );
+
+	auto const &scores = cols.column<2>( );
+	ensure( scores == std::vector<double>{ 1.5, -2.0, 0.25 } );
+
+	auto const &parents = cols.column<3>( );
+	ensure( not parents[0] );
+	ensure( parents[1] and *parents[1] == 1 );
+	ensure( not parents[2] );
+
+	auto const &active = cols.column<4>( );
+	ensure( active == std::vector<bool>{ true, false, true } );
+
+	constexpr std::string_view json_data2 = R"json({"rows":[{"id":5,"name":"x","score":1,"active":false}]})json";
+	auto const cols2 = daw::json::from_json_columns<Row>( json_data2, "rows" );
+	ensure( cols2.size( ) == 1 );
+	ensure( cols2.column<0>( )[0] == 5 );
+	ensure( cols2.column<1>( )[0] == "x" );
+
+	auto const empty_cols = daw::json::from_json_columns<Row>( "[]" );
+	ensure( empty_cols.empty( ) );
+	ensure( empty_cols.column<1>( ).empty( ) );
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
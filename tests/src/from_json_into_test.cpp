@@ -0,0 +1,249 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_from_json_into.h>
+#include <daw/json/daw_json_link.h>
+
+#include <iostream>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+struct Item {
+	std::string key;
+	int value;
+};
+
+struct Message {
+	int id;
+	std::string name;
+	std::vector<Item> items;
+	std::map<std::string, int> counts;
+	std::optional<std::string> note;
+};
+
+struct Point {
+	int x;
+	int y;
+};
+
+// The data contract constructor normalizes the value
+struct Percent {
+	int value;
+};
+
+struct PercentConstructor {
+	constexpr Percent operator( )( int v ) const {
+		return Percent{ v > 100 ? 100 : v };
+	}
+};
+
+// The constructor validates the value
+class Positive {
+	int m_value;
+
+public:
+	explicit Positive( int v )
+	  : m_value( v > 0 ? v : 1 ) {}
+
+	int const &value( ) const {
+		return m_value;
+	}
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Item> {
+		static constexpr char const key[] = "key";
+		static constexpr char const value[] = "value";
+		using type =
+		  json_member_list<json_link<key, std::string>, json_link<value, int>>;
+
+		static constexpr auto to_json_data( Item const &i ) {
+			return std::forward_as_tuple( i.key, i.value );
+		}
+	};
+
+	template<>
+	struct json_data_contract<Message> {
+		static constexpr char const id[] = "id";
+		static constexpr char const name[] = "name";
+		static constexpr char const items[] = "items";
+		static constexpr char const counts[] = "counts";
+		static constexpr char const note[] = "note";
+		using type = json_member_list<
+		  json_link<id, int>, json_link<name, std::string>,
+		  json_link<items, std::vector<Item>>,
+		  json_link<counts, std::map<std::string, int>>,
+		  json_link<note, std::optional<std::string>>>;
+
+		static constexpr auto to_json_data( Message const &m ) {
+			return std::forward_as_tuple( m.id, m.name, m.items, m.counts, m.note );
+		}
+	};
+
+	// to_json_data does not return references, from_json_into falls back to
+	// assigning the result of from_json
+	template<>
+	struct json_data_contract<Point> {
+		static constexpr char const x[] = "x";
+		static constexpr char const y[] = "y";
+		using type = json_member_list<json_link<x, int>, json_link<y, int>>;
+
+		static constexpr auto to_json_data( Point const &p ) {
+			return std::tuple<int, int>( p.x, p.y );
+		}
+	};
+
+	template<>
+	struct json_data_contract<Percent> {
+		using constructor_t = PercentConstructor;
+		static constexpr char const value[] = "value";
+		using type = json_member_list<json_link<value, int>>;
+
+		static constexpr auto to_json_data( Percent const &p ) {
+			return std::forward_as_tuple( p.value );
+		}
+	};
+
+	template<>
+	struct json_data_contract<Positive> {
+		static constexpr char const value[] = "value";
+		using type = json_member_list<json_link<value, int>>;
+
+		static auto to_json_data( Positive const &p ) {
+			return std::forward_as_tuple( p.value( ) );
+		}
+	};
+} // namespace daw::json
+
+static_assert( daw::json::json_details::is_into_class_v<Message> );
+static_assert( daw::json::json_details::is_into_class_v<Item> );
+static_assert( not daw::json::json_details::is_into_class_v<Point> );
+static_assert( not daw::json::json_details::is_into_class_v<Percent> );
+static_assert( not daw::json::json_details::is_into_class_v<Positive> );
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	constexpr std::string_view json_data1 = R"json(
+{
+  "id": 1,
+  "name": "a name that is longer than the small string buffer",
+  "items": [
+    {"key": "first key that is also quite long to avoid sso", "value": 1},
+    {"key": "second", "value": 2},
+    {"key": "third", "value": 3}
+  ],
+  "counts": {"a": 1, "b": 2},
+  "note": "a note that is longer than the small string buffer"
+})json";
+
+	constexpr std::string_view json_data2 = R"json(
+{
+  "items": [
+    {"value": 10, "key": "one"},
+    {"key": "t\"wo", "value": 20}
+  ],
+  "name": "short",
+  "id": 2,
+  "counts": {"b": 20, "a": 10},
+  "note": "short note"
+})json";
+
+	auto msg = Message{ };
+	daw::json::from_json_into( msg, json_data1 );
+	ensure( msg.id == 1 );
+	ensure( msg.name == "a name that is longer than the small string buffer" );
+	ensure( msg.items.size( ) == 3 );
+	ensure( msg.items[2].key == "third" and msg.items[2].value == 3 );
+	ensure( msg.counts.size( ) == 2 and msg.counts["b"] == 2 );
+	ensure( msg.note and msg.note->size( ) > 20 );
+
+	char const *const name_data = msg.name.data( );
+	Item const *const items_data = msg.items.data( );
+	char const *const item0_data = msg.items[0].key.data( );
+	int const *const count_a = &msg.counts["a"];
+	char const *const note_data = msg.note->data( );
+
+	daw::json::from_json_into( msg, json_data2 );
+	ensure( msg.id == 2 );
+	ensure( msg.name == "short" );
+	ensure( msg.items.size( ) == 2 );
+	ensure( msg.items[0].key == "one" and msg.items[0].value == 10 );
+	ensure( msg.items[1].key == "t\"wo" and msg.items[1].value == 20 );
+	ensure( msg.counts.size( ) == 2 and msg.counts["a"] == 10 and
+	        msg.counts["b"] == 20 );
+	ensure( msg.note and *msg.note == "short note" );
+	// The storage from the first parse was reused
+	ensure( msg.name.data( ) == name_data );
+	ensure( msg.items.data( ) == items_data );
+	ensure( msg.items[0].key.data( ) == item0_data );
+	ensure( &msg.counts["a"] == count_a );
+	ensure( msg.note->data( ) == note_data );
+
+	// Missing nullable members are reset and stale keys removed
+	daw::json::from_json_into(
+	  msg,
+	  R"json({"id":3,"name":"","items":[],"counts":{"c":3},"unknown":[1,2]})json" );
+	ensure( msg.id == 3 );
+	ensure( msg.name.empty( ) );
+	ensure( msg.items.empty( ) );
+	ensure( msg.counts.size( ) == 1 and msg.counts["c"] == 3 );
+	ensure( not msg.note );
+
+	// Duplicate keys do not hide the stale ones
+	msg.counts = { { "a", 1 }, { "b", 2 } };
+	constexpr std::string_view json_dup_keys =
+	  R"json({"id":4,"name":"","items":[],"counts":{"a":1,"a":2}})json";
+	daw::json::from_json_into( msg, json_dup_keys );
+	auto const dup_keys_msg = daw::json::from_json<Message>( json_dup_keys );
+	ensure( msg.counts == dup_keys_msg.counts );
+	ensure( msg.counts.count( "b" ) == 0 );
+
+	auto p = Point{ 1, 2 };
+	daw::json::from_json_into( p, R"json({"x":3,"y":4})json" );
+	ensure( p.x == 3 and p.y == 4 );
+
+	// The constructors are used, the same as from_json
+	auto pct = Percent{ 1 };
+	daw::json::from_json_into( pct, R"json({"value":250})json" );
+	ensure( pct.value == 100 );
+
+	auto pos = Positive( 5 );
+	daw::json::from_json_into( pos, R"json({"value":-3})json" );
+	ensure( pos.value( ) == 1 );
+
+#ifdef DAW_USE_EXCEPTIONS
+	bool has_error = false;
+	try {
+		daw::json::from_json_into( msg, R"json({"name":"no id"})json" );
+	} catch( daw::json::json_exception const & ) { has_error = true; }
+	ensure( has_error );
+#endif
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,337 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Counts the heap allocations made while parsing and serializing the
+// benchmark documents, along with the timings.  Every allocation of the
+// process goes through the replaced global operator new below, except for the
+// to_json output buffers.  Those use counting_allocator, which takes memory
+// from std::malloc, so they are reported on their own line.  The timings
+// include the cost of counting, compare them to other json_alloc_bench
+// results and not to json_benchmark
+//
+
+#include "apache_builds_json.h"
+#include "bench_driver.h"
+#include "citm_test_json.h"
+#include "counting_alloc.h"
+#include "geojson_json.h"
+#include "twitter_test_json.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/daw_read_file.h>
+#include <daw/daw_utility.h>
+#include <daw/json/daw_from_json.h>
+#include <daw/json/daw_to_json.h>
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <ios>
+#include <iostream>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 250;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+inline namespace {
+	daw::alloc_counters &global_alloc_counters( ) {
+		static daw::alloc_counters counters{ };
+		return counters;
+	}
+
+	// The size of each allocation is stored before it so that the unsized
+	// operator delete can count it.  This keeps the memory aligned for any
+	// type that is not over aligned
+	constexpr std::size_t alloc_header_size = alignof( std::max_align_t );
+
+	void *counted_malloc( std::size_t size ) noexcept {
+		auto *ptr =
+		  static_cast<unsigned char *>( std::malloc( size + alloc_header_size ) );
+		if( ptr == nullptr ) {
+			return nullptr;
+		}
+		std::memcpy( ptr, &size, sizeof( size ) );
+		global_alloc_counters( ).on_allocate( size );
+		return ptr + alloc_header_size;
+	}
+
+	void counted_free( void *p ) noexcept {
+		if( p == nullptr ) {
+			return;
+		}
+		auto *ptr = static_cast<unsigned char *>( p ) - alloc_header_size;
+		std::size_t size = 0;
+		std::memcpy( &size, ptr, sizeof( size ) );
+		global_alloc_counters( ).on_deallocate( size );
+		std::free( ptr );
+	}
+
+	void *counted_new( std::size_t size ) {
+		if( void *result = counted_malloc( size ) ) {
+			return result;
+		}
+#if defined( DAW_USE_EXCEPTIONS )
+		throw std::bad_alloc( );
+#else
+		std::abort( );
+#endif
+	}
+} // namespace
+
+// The over aligned forms are not replaced, the benchmarked types do not use
+// them
+void *operator new( std::size_t size ) {
+	return counted_new( size );
+}
+
+void *operator new[]( std::size_t size ) {
+	return counted_new( size );
+}
+
+void *operator new( std::size_t size, std::nothrow_t const & ) noexcept {
+	return counted_malloc( size );
+}
+
+void *operator new[]( std::size_t size, std::nothrow_t const & ) noexcept {
+	return counted_malloc( size );
+}
+
+void operator delete( void *p ) noexcept {
+	counted_free( p );
+}
+
+void operator delete[]( void *p ) noexcept {
+	counted_free( p );
+}
+
+void operator delete( void *p, std::size_t ) noexcept {
+	counted_free( p );
+}
+
+void operator delete[]( void *p, std::size_t ) noexcept {
+	counted_free( p );
+}
+
+void operator delete( void *p, std::nothrow_t const & ) noexcept {
+	counted_free( p );
+}
+
+void operator delete[]( void *p, std::nothrow_t const & ) noexcept {
+	counted_free( p );
+}
+
+inline namespace {
+	using counting_string =
+	  std::basic_string<char, std::char_traits<char>,
+	                    daw::counting_allocator<char>>;
+
+	void show_result( daw::bench::bench_result const &result ) {
+		std::cout << "test name:                " << result.name << '\n';
+		std::cout << "data size:                "
+		          << daw::utility::to_bytes_per_second( result.data_size, 1.0, 2 )
+		          << '\n';
+		if( result.throughput_mb_per_second ) {
+			std::cout << "median throughput:        " << std::fixed
+			          << *result.throughput_mb_per_second << "MB/s\n";
+		}
+		std::cout << "min duration:             " << result.duration_min << '\n';
+		std::cout << "50th percentile duration: " << result.duration_50th_percentile
+		          << '\n';
+		std::cout << "max duration:             " << result.duration_max << '\n';
+		std::cout << "allocations/document:     "
+		          << *result.allocations_per_document << '\n';
+		std::cout << "bytes allocated/document: "
+		          << *result.bytes_allocated_per_document << '\n';
+		std::cout << "peak live bytes:          " << *result.peak_live_bytes
+		          << '\n';
+	}
+
+	/***
+	 * Call func DAW_NUM_RUNS times, timing it and counting the allocations made
+	 * by it and by destroying its result.  The peak live bytes are the most
+	 * bytes allocated at once during a run, beyond those live before it
+	 */
+	template<typename Function>
+	daw::bench::bench_result bench_allocations( std::string const &name,
+	                                            std::size_t data_size,
+	                                            Function const &func ) {
+		{
+			// The first run can allocate state that is lazily initialized once
+			auto const result = func( );
+			daw::do_not_optimize( result );
+		}
+		auto &counters = global_alloc_counters( );
+		auto run_times = std::vector<std::chrono::nanoseconds>( );
+		run_times.reserve( DAW_NUM_RUNS );
+		std::size_t allocations = 0;
+		std::size_t bytes = 0;
+		std::size_t peak_live_bytes = 0;
+		for( std::size_t n = 0; n < DAW_NUM_RUNS; ++n ) {
+			counters.reset_peak( );
+			auto const before = counters.snapshot( );
+			{
+				auto const start = std::chrono::steady_clock::now( );
+				auto const result = func( );
+				auto const finish = std::chrono::steady_clock::now( );
+				daw::do_not_optimize( result );
+				run_times.push_back(
+				  std::chrono::duration_cast<std::chrono::nanoseconds>( finish -
+				                                                        start ) );
+			}
+			auto const after = counters.snapshot( );
+			allocations += after.allocations - before.allocations;
+			bytes += after.bytes - before.bytes;
+			peak_live_bytes =
+			  ( std::max )( peak_live_bytes,
+			                after.peak_live_bytes - before.live_bytes );
+		}
+		auto result = make_bench_result( name, data_size, std::move( run_times ),
+		                                 "json_alloc_bench" );
+		process_results( result );
+		result.allocations_per_document =
+		  static_cast<double>( allocations ) / static_cast<double>( DAW_NUM_RUNS );
+		result.bytes_allocated_per_document =
+		  static_cast<double>( bytes ) / static_cast<double>( DAW_NUM_RUNS );
+		result.peak_live_bytes = peak_live_bytes;
+		return result;
+	}
+
+	/***
+	 * Benchmark parsing json_data with parse, serializing the result to a new
+	 * string, and serializing it to a string that is reused.  The strings use
+	 * a counting_allocator to tell the allocations of the output buffer apart
+	 * from those of the serializer
+	 */
+	template<typename Parser>
+	void bench_document( std::vector<daw::bench::bench_result> &results,
+	                     std::string const &name, std::string const &json_data,
+	                     Parser const &parse ) {
+		results.push_back( bench_allocations(
+		  name + " from_json", json_data.size( ),
+		  [&] { return parse( json_data ); } ) );
+
+		auto const value = parse( json_data );
+		auto const json_size = daw::json::to_json( value ).size( );
+		auto output_counters = daw::alloc_counters( );
+		auto const output_before = output_counters.snapshot( );
+		results.push_back(
+		  bench_allocations( name + " to_json", json_size, [&] {
+			  auto out =
+			    counting_string( daw::counting_allocator<char>( output_counters ) );
+			  (void)daw::json::to_json( value, out );
+			  return out;
+		  } ) );
+		auto const output_after = output_counters.snapshot( );
+		// The warm up run is counted here as well
+		std::cout << name << " to_json output buffer allocations/document: "
+		          << static_cast<double>( output_after.allocations -
+		                                  output_before.allocations ) /
+		               static_cast<double>( DAW_NUM_RUNS + 1U )
+		          << '\n';
+
+		auto buffer =
+		  counting_string( daw::counting_allocator<char>( output_counters ) );
+		buffer.reserve( json_size );
+		results.push_back( bench_allocations(
+		  name + " to_json reused buffer", json_size, [&] {
+			  buffer.clear( );
+			  (void)daw::json::to_json( value, buffer );
+			  return buffer.size( );
+		  } ) );
+	}
+
+} // namespace
+
+int main( int argc, char **argv )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+#if defined( NDEBUG ) or not defined( DEBUG )
+	std::cout << "Release build\n";
+#else
+	std::cout << "Debug build\n";
+#endif
+	if( argc < 5 ) {
+		std::cerr
+		  << "Usage: " << argv[0]
+		  << " apache_builds.json twitter.json citm_catalog.json canada.json "
+		     "[results_file]\n"
+		     "The results are appended to results_file when it is given\n";
+		exit( 1 );
+	}
+	auto const json_data_apache = *daw::read_file( argv[1] );
+	assert( json_data_apache.size( ) > 2 and "Minimum json data size is 2 '{}'" );
+	auto const json_data_twitter = *daw::read_file( argv[2] );
+	assert( json_data_twitter.size( ) > 2 and
+	        "Minimum json data size is 2 '{}'" );
+	auto const json_data_citm = *daw::read_file( argv[3] );
+	assert( json_data_citm.size( ) > 2 and "Minimum json data size is 2 '{}'" );
+	auto const json_data_canada = *daw::read_file( argv[4] );
+	assert( json_data_canada.size( ) > 2 and "Minimum json data size is 2 '{}'" );
+
+	auto results = std::vector<daw::bench::bench_result>( );
+	bench_document( results, "apache builds", json_data_apache,
+	                []( std::string const &jd ) {
+		                return daw::json::from_json<apache_builds::apache_builds>(
+		                  jd );
+	                } );
+	bench_document( results, "twitter", json_data_twitter,
+	                []( std::string const &jd ) {
+		                return daw::json::from_json<daw::twitter::twitter_object_t>(
+		                  jd );
+	                } );
+	bench_document( results, "citm catalog", json_data_citm,
+	                []( std::string const &jd ) {
+		                return daw::json::from_json<daw::citm::citm_object_t>( jd );
+	                } );
+	bench_document( results, "canada", json_data_canada,
+	                []( std::string const &jd ) {
+		                return daw::json::from_json<daw::geojson::Polygon>(
+		                  jd, "features[0].geometry" );
+	                } );
+
+	for( auto const &r : results ) {
+		show_result( r );
+		std::cout << '\n';
+	}
+	if( argc > 5 ) {
+		auto all_results = read_results_file( argv[5] );
+		all_results.insert( all_results.end( ), results.begin( ), results.end( ) );
+		auto const out_data = daw::json::to_json_array( all_results );
+		auto out_file = std::ofstream( argv[5], std::ios::out | std::ios::trunc );
+		assert( out_file );
+		out_file.write( out_data.data( ),
+		                static_cast<std::streamsize>( out_data.size( ) ) );
+	}
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
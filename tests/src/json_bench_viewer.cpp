@@ -85,6 +85,10 @@ static void show_result( daw::bench::bench_result const &result ) {
 	          << daw::utility::to_bytes_per_second(
 	               static_cast<double>( result.data_size ) / min_ts, 1.0, 2 )
 	          << "/s\n";
+	if( result.throughput_mb_per_second ) {
+		std::cout << "median throughput:        "
+		          << *result.throughput_mb_per_second << "MB/s\n";
+	}
 	std::cout << "runs/second:              " << std::fixed
 	          << ( 1.0 / to_fract( result.duration_min ) ) << '\n';
 	std::cout << "min duration:             " << result.duration_min << '\n';
@@ -95,6 +99,18 @@ static void show_result( daw::bench::bench_result const &result ) {
 	std::cout << "75th percentile duration: " << result.duration_75th_percentile
 	          << '\n';
 	std::cout << "max duration:             " << result.duration_max << '\n';
+	if( result.allocations_per_document ) {
+		std::cout << "allocations/document:     "
+		          << *result.allocations_per_document << '\n';
+	}
+	if( result.bytes_allocated_per_document ) {
+		std::cout << "bytes allocated/document: "
+		          << *result.bytes_allocated_per_document << '\n';
+	}
+	if( result.peak_live_bytes ) {
+		std::cout << "peak live bytes:          " << *result.peak_live_bytes
+		          << '\n';
+	}
 	std::cout << "build type:               " << result.build_type << '\n';
 }
 
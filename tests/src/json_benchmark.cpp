@@ -7,7 +7,7 @@
 //
 
 #include "apache_builds_json.h"
-#include "bench_result.h"
+#include "bench_driver.h"
 #include "citm_test_json.h"
 #include "geojson_json.h"
 #include "twitter_test_json.h"
@@ -18,42 +18,17 @@
 #include <daw/json/daw_from_json.h>
 #include <daw/json/daw_to_json.h>
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <cstddef>
+#include <cstdlib>
 #include <fstream>
 #include <ios>
+#include <iostream>
+#include <string>
 #include <string_view>
-
-// These come from build system and must be defined
-#ifndef SOURCE_CONTROL_REVISION
-#error "SOURCE_CONTROL_REVSION must be defined"
-#endif
-#ifndef PROCESSOR_DESCRIPTION
-#error "PROCESSOR_DESCRIPTION must be defined"
-#endif
-#ifndef OS_NAME
-#error "OS_NAME must be defined"
-#endif
-#ifndef OS_RELEASE
-#error "OS_RELEASE must be defined"
-#endif
-#ifndef OS_VERSION
-#error "OS_VERSION must be defined"
-#endif
-#ifndef OS_PLATFORM
-#error "OS_PLATFORM must be defined"
-#endif
-#ifndef BUILD_TYPE
-#error "BUILD_TYPE must be defined"
-#endif
-
-inline constexpr auto CheckedPolicy =
-  daw::json::options::parse_flags<daw::json::options::ExecModeTypes::simd>;
-
-inline constexpr auto UncheckedPolicy =
-  daw::json::options::parse_flags<daw::json::options::CheckedParseMode::no,
-                                  daw::json::options::ExecModeTypes::simd>;
+#include <vector>
 
 #if not defined( DAW_NUM_RUNS )
 #if not defined( DEBUG ) or defined( NDEBUG )
@@ -65,62 +40,6 @@ static inline constexpr std::size_t DAW_NUM_RUNS = 2;
 static_assert( DAW_NUM_RUNS > 0 );
 
 inline namespace {
-	daw::bench::bench_result
-	make_bench_result( std::string const &name, std::size_t data_size,
-	                   std::vector<std::chrono::nanoseconds> run_times ) {
-		return { name,
-		         std::chrono::time_point_cast<std::chrono::milliseconds>(
-		           std::chrono::system_clock::now( ) ),
-		         data_size,
-		         std::move( run_times ),
-		         { },
-		         { },
-		         { },
-		         { },
-		         { },
-		         SOURCE_CONTROL_REVISION,
-		         PROCESSOR_DESCRIPTION,
-		         OS_NAME,
-		         OS_RELEASE,
-		         OS_VERSION,
-		         OS_PLATFORM,
-		         BUILD_TYPE,
-		         "daw_json_link",
-		         "json_benchmark" };
-	}
-
-	std::ostream &operator<<( std::ostream &os, std::chrono::nanoseconds t ) {
-		auto const ae = daw::on_scope_exit(
-		  [&os, old_flags = std::ios_base::fmtflags( os.flags( ) )] {
-			  os.flags( old_flags );
-		  } );
-
-		os << std::setprecision( static_cast<int>( 2 ) ) << std::fixed;
-		auto val = static_cast<double>( t.count( ) );
-		if( val < 1000 ) {
-			os << val << "ns";
-			return os;
-		}
-		val /= 1000.0;
-		if( val < 1000 ) {
-			os << val << "us";
-			return os;
-		}
-		val /= 1000.0;
-		if( val < 1000 ) {
-			os << val << "ms";
-			return os;
-		}
-		val /= 1000.0;
-		os << val << "s";
-		return os;
-	}
-
-	constexpr double to_fract( std::chrono::nanoseconds ns ) {
-		using dest_t = std::chrono::duration<double>;
-		return std::chrono::duration_cast<dest_t>( ns ).count( );
-	}
-
 	void show_result( daw::bench::bench_result const &result ) {
 		auto const min_ts =
 		  static_cast<double>(
@@ -135,6 +54,10 @@ inline namespace {
 		          << daw::utility::to_bytes_per_second(
 		               static_cast<double>( result.data_size ) / min_ts, 1.0, 2 )
 		          << "/s\n";
+		if( result.throughput_mb_per_second ) {
+			std::cout << "median throughput:        "
+			          << *result.throughput_mb_per_second << "MB/s\n";
+		}
 		std::cout << "runs/second:              " << std::fixed
 		          << ( 1.0 / to_fract( result.duration_min ) ) << '\n';
 		std::cout << "min duration:             " << result.duration_min << '\n';
@@ -148,358 +71,98 @@ inline namespace {
 		std::cout << "build type:               " << result.build_type << '\n';
 	}
 
-	void process_results( daw::bench::bench_result &jr ) {
-
-		auto runs = jr.run_times;
-		std::sort( runs.begin( ), runs.end( ) );
-		std::size_t const bin_25 = runs.size( ) / 4U;
-		std::size_t const bin_50 = 2 * ( runs.size( ) / 4U );
-		std::size_t const bin_75 = ( runs.size( ) - 1U ) - bin_50;
-		jr.duration_min = runs.front( );
-		jr.duration_max = runs.back( );
-		jr.duration_25th_percentile = runs[bin_25];
-		jr.duration_50th_percentile = runs[bin_50];
-		jr.duration_75th_percentile = runs[bin_75];
-	}
-
-	daw::bench::bench_result
-	do_apache_builds_from_json_test( std::string const &json_data ) {
-		auto const tst = [json_data]( auto parse_policy ) {
-			return make_bench_result(
-			  "apache builds from_json(checked)", json_data.size( ),
-			  daw::bench_n_test_json<DAW_NUM_RUNS>(
-			    [parse_policy]( std::string const &jd ) {
-				    return daw::json::from_json<apache_builds::apache_builds>(
-				      jd, parse_policy );
-			    },
-			    json_data ) );
-		};
-
-		daw::bench::bench_result res[3] = {
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::ExecModeTypes::compile_time> ),
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::ExecModeTypes::runtime> ),
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::ExecModeTypes::simd> ) };
-
-		auto &result =
-		  *std::min_element( res, res + 3, []( auto const &lhs, auto const &rhs ) {
-			  return lhs.duration_min < rhs.duration_min;
-		  } );
-		process_results( result );
-		return result;
-	}
-
-	daw::bench::bench_result
-	do_apache_builds_from_json_test_unchecked( std::string const &json_data ) {
-		auto const tst = [json_data]( auto parse_policy ) {
-			return make_bench_result(
-			  "apache builds from_json(unchecked)", json_data.size( ),
-			  daw::bench_n_test_json<DAW_NUM_RUNS>(
-			    [parse_policy]( std::string const &jd ) {
-				    return daw::json::from_json<apache_builds::apache_builds>(
-				      jd, parse_policy );
-			    },
-			    json_data ) );
-		};
-
-		daw::bench::bench_result res[3] = {
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::CheckedParseMode::no,
-		       daw::json::options::ExecModeTypes::compile_time> ),
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::CheckedParseMode::no,
-		       daw::json::options::ExecModeTypes::runtime> ),
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::CheckedParseMode::no,
-		       daw::json::options::ExecModeTypes::simd> ) };
-
-		auto &result =
-		  *std::min_element( res, res + 3, []( auto const &lhs, auto const &rhs ) {
-			  return lhs.duration_min < rhs.duration_min;
-		  } );
-		process_results( result );
-		return result;
-	}
-
-	daw::bench::bench_result
-	do_twitter_from_json_test( std::string const &json_data ) {
-		auto const tst = [json_data]( auto parse_policy ) {
-			return make_bench_result(
-			  "twitter from_json(checked)", json_data.size( ),
-			  daw::bench_n_test_json<DAW_NUM_RUNS>(
-			    [parse_policy]( std::string const &jd ) {
-				    return daw::json::from_json<daw::twitter::twitter_object_t>(
-				      jd, parse_policy );
-			    },
-			    json_data ) );
-		};
-
-		daw::bench::bench_result res[3] = {
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::ExecModeTypes::compile_time> ),
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::ExecModeTypes::runtime> ),
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::ExecModeTypes::simd> ) };
-
-		auto &result =
-		  *std::min_element( res, res + 3, []( auto const &lhs, auto const &rhs ) {
-			  return lhs.duration_min < rhs.duration_min;
-		  } );
-
-		process_results( result );
-		return result;
-	}
-
-	daw::bench::bench_result
-	do_twitter_from_json_test_unchecked( std::string const &json_data ) {
-		auto const tst = [json_data]( auto parse_policy ) {
-			return make_bench_result(
-			  "twitter from_json(unchecked)", json_data.size( ),
-			  daw::bench_n_test_json<DAW_NUM_RUNS>(
-			    [parse_policy]( std::string const &jd ) {
-				    return daw::json::from_json<daw::twitter::twitter_object_t>(
-				      jd, parse_policy );
-			    },
-			    json_data ) );
-		};
-
-		daw::bench::bench_result res[3] = {
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::CheckedParseMode::no,
-		       daw::json::options::ExecModeTypes::compile_time> ),
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::CheckedParseMode::no,
-		       daw::json::options::ExecModeTypes::runtime> ),
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::CheckedParseMode::no,
-		       daw::json::options::ExecModeTypes::simd> ) };
-
-		auto &result =
-		  *std::min_element( res, res + 3, []( auto const &lhs, auto const &rhs ) {
-			  return lhs.duration_min < rhs.duration_min;
-		  } );
-
-		process_results( result );
-		return result;
-	}
-
-	daw::bench::bench_result
-	do_citm_from_json_test( std::string const &json_data ) {
-		auto const tst = [json_data]( auto parse_policy ) {
-			return make_bench_result(
-			  "citm catalog from_json(checked)", json_data.size( ),
-			  daw::bench_n_test_json<DAW_NUM_RUNS>(
-			    [parse_policy]( std::string const &jd ) {
-				    return daw::json::from_json<daw::citm::citm_object_t>(
-				      jd, parse_policy );
-			    },
-			    json_data ) );
-		};
-
-		daw::bench::bench_result res[3] = {
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::ExecModeTypes::compile_time> ),
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::ExecModeTypes::runtime> ),
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::ExecModeTypes::simd> ) };
-
-		auto &result =
-		  *std::min_element( res, res + 3, []( auto const &lhs, auto const &rhs ) {
-			  return lhs.duration_min < rhs.duration_min;
-		  } );
-
-		process_results( result );
-		return result;
-	}
-
-	daw::bench::bench_result
-	do_citm_from_json_test_unchecked( std::string const &json_data ) {
-		auto const tst = [json_data]( auto parse_policy ) {
-			return make_bench_result(
-			  "citm catalog from_json(unchecked)", json_data.size( ),
-			  daw::bench_n_test_json<DAW_NUM_RUNS>(
-			    [parse_policy]( std::string const &jd ) {
-				    return daw::json::from_json<daw::citm::citm_object_t>(
-				      jd, parse_policy );
-			    },
-			    json_data ) );
-		};
-
-		daw::bench::bench_result res[3] = {
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::CheckedParseMode::no,
-		       daw::json::options::ExecModeTypes::compile_time> ),
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::CheckedParseMode::no,
-		       daw::json::options::ExecModeTypes::runtime> ),
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::CheckedParseMode::no,
-		       daw::json::options::ExecModeTypes::simd> ) };
-
-		auto &result =
-		  *std::min_element( res, res + 3, []( auto const &lhs, auto const &rhs ) {
-			  return lhs.duration_min < rhs.duration_min;
-		  } );
-
-		process_results( result );
-		return result;
-	}
-
-	daw::bench::bench_result
-	do_canada_from_json_test( std::string const &json_data ) {
-		auto const tst = [json_data]( auto parse_policy ) {
-			return make_bench_result(
-			  "canada from_json(checked)", json_data.size( ),
-			  daw::bench_n_test_json<DAW_NUM_RUNS>(
-			    [parse_policy]( std::string const &jd ) {
-				    return daw::json::from_json<daw::geojson::Polygon>(
-				      jd, "features[0].geometry", parse_policy );
-			    },
-			    json_data ) );
-		};
-
-		daw::bench::bench_result res[3] = {
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::ExecModeTypes::compile_time> ),
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::ExecModeTypes::runtime> ),
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::ExecModeTypes::simd> ) };
-
-		auto &result =
-		  *std::min_element( res, res + 3, []( auto const &lhs, auto const &rhs ) {
-			  return lhs.duration_min < rhs.duration_min;
-		  } );
-
-		process_results( result );
-		return result;
-	}
-
-	daw::bench::bench_result
-	do_canada_from_json_test_unchecked( std::string const &json_data ) {
-		auto const tst = [json_data]( auto parse_policy ) {
-			return make_bench_result(
-			  "canada from_json(unchecked)", json_data.size( ),
-			  daw::bench_n_test_json<DAW_NUM_RUNS>(
-			    [parse_policy]( std::string const &jd ) {
-				    return daw::json::from_json<daw::geojson::Polygon>(
-				      jd, "features[0].geometry", parse_policy );
-			    },
-			    json_data ) );
-		};
-
-		daw::bench::bench_result res[3] = {
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::CheckedParseMode::no,
-		       daw::json::options::ExecModeTypes::compile_time> ),
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::CheckedParseMode::no,
-		       daw::json::options::ExecModeTypes::runtime> ),
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::CheckedParseMode::no,
-		       daw::json::options::ExecModeTypes::simd> ) };
-
-		auto &result =
-		  *std::min_element( res, res + 3, []( auto const &lhs, auto const &rhs ) {
-			  return lhs.duration_min < rhs.duration_min;
-		  } );
-
+	/// Benchmark func with one parse policy.  func is called with the parse
+	/// policy followed by the json_data
+	template<daw::json::options::CheckedParseMode Checked,
+	         daw::json::options::ExecModeTypes ExecMode, typename Function,
+	         typename... JsonData>
+	daw::bench::bench_result bench_policy( std::string const &name,
+	                                       Function const &func,
+	                                       JsonData const &...json_data ) {
+		constexpr auto parse_policy =
+		  daw::json::options::parse_flags<Checked, ExecMode>;
+		auto const mode = daw::json::options::to_string( ExecMode );
+		auto const test_name =
+		  name + " from_json(" +
+		  ( Checked == daw::json::options::CheckedParseMode::yes ? "checked"
+		                                                         : "unchecked" ) +
+		  ", " + std::string( mode.data( ), mode.size( ) ) + ")";
+		auto result = make_bench_result(
+		  test_name, ( std::size( json_data ) + ... ),
+		  daw::bench_n_test_json<DAW_NUM_RUNS>(
+		    [&]( auto const &...jd ) {
+			    return func( parse_policy, jd... );
+		    },
+		    json_data... ),
+		  "json_benchmark" );
 		process_results( result );
 		return result;
 	}
 
-	daw::bench::bench_result
-	do_nativejson_from_json_test( std::string const &json_data_twitter,
-	                              std::string const &json_data_citm,
-	                              std::string const &json_data_canada ) {
-		auto const tst = [json_data_twitter, json_data_citm,
-		                  json_data_canada]( auto parse_policy ) {
-			return make_bench_result(
-			  "nativejson benchmark from_json(checked)",
-			  json_data_twitter.size( ) + json_data_citm.size( ) +
-			    json_data_canada.size( ),
-			  daw::bench_n_test_json<DAW_NUM_RUNS>(
-			    [&]( std::string const &tw, std::string const &ci,
-			         std::string const &ca ) {
-				    auto const j1 =
-				      daw::json::from_json<daw::twitter::twitter_object_t>(
-				        tw, parse_policy );
-				    auto const j2 = daw::json::from_json<daw::citm::citm_object_t>(
-				      ci, parse_policy );
-				    auto const j3 = daw::json::from_json<daw::geojson::Polygon>(
-				      ca, "features[0].geometry", parse_policy );
-				    daw::do_not_optimize( j1 );
-				    daw::do_not_optimize( j2 );
-				    daw::do_not_optimize( j3 );
-			    },
-			    json_data_twitter, json_data_citm, json_data_canada ) );
-		};
-
-		daw::bench::bench_result res[3] = {
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::ExecModeTypes::compile_time> ),
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::ExecModeTypes::runtime> ),
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::ExecModeTypes::simd> ) };
-
-		auto &result =
-		  *std::min_element( res, res + 3, []( auto const &lhs, auto const &rhs ) {
-			  return lhs.duration_min < rhs.duration_min;
-		  } );
-
-		process_results( result );
-		return result;
+	/// Benchmark func under every exec mode, checked and unchecked
+	template<typename Function, typename... JsonData>
+	void bench_all_policies( std::vector<daw::bench::bench_result> &results,
+	                         std::string const &name, Function const &func,
+	                         JsonData const &...json_data ) {
+		using daw::json::options::CheckedParseMode;
+		using daw::json::options::ExecModeTypes;
+		results.push_back(
+		  bench_policy<CheckedParseMode::yes, ExecModeTypes::compile_time>(
+		    name, func, json_data... ) );
+		results.push_back(
+		  bench_policy<CheckedParseMode::yes, ExecModeTypes::runtime>(
+		    name, func, json_data... ) );
+		results.push_back( bench_policy<CheckedParseMode::yes, ExecModeTypes::simd>(
+		  name, func, json_data... ) );
+		results.push_back(
+		  bench_policy<CheckedParseMode::no, ExecModeTypes::compile_time>(
+		    name, func, json_data... ) );
+		results.push_back(
+		  bench_policy<CheckedParseMode::no, ExecModeTypes::runtime>(
+		    name, func, json_data... ) );
+		results.push_back( bench_policy<CheckedParseMode::no, ExecModeTypes::simd>(
+		  name, func, json_data... ) );
 	}
 
-	daw::bench::bench_result do_nativejson_from_json_test_unchecked(
-	  std::string const &json_data_twitter, std::string const &json_data_citm,
-	  std::string const &json_data_canada ) {
-		auto const tst = [json_data_twitter, json_data_citm,
-		                  json_data_canada]( auto parse_policy ) {
-			return make_bench_result(
-			  "nativejson benchmark from_json(unchecked)",
-			  json_data_twitter.size( ) + json_data_citm.size( ) +
-			    json_data_canada.size( ),
-			  daw::bench_n_test_json<DAW_NUM_RUNS>(
-			    [&]( std::string const &tw, std::string const &ci,
-			         std::string const &ca ) {
-				    auto const j1 =
-				      daw::json::from_json<daw::twitter::twitter_object_t>(
-				        tw, parse_policy );
-				    auto const j2 = daw::json::from_json<daw::citm::citm_object_t>(
-				      ci, parse_policy );
-				    auto const j3 = daw::json::from_json<daw::geojson::Polygon>(
-				      ca, "features[0].geometry", parse_policy );
-				    daw::do_not_optimize( j1 );
-				    daw::do_not_optimize( j2 );
-				    daw::do_not_optimize( j3 );
-			    },
-			    json_data_twitter, json_data_citm, json_data_canada ) );
-		};
-
-		daw::bench::bench_result res[3] = {
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::CheckedParseMode::no,
-		       daw::json::options::ExecModeTypes::compile_time> ),
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::CheckedParseMode::no,
-		       daw::json::options::ExecModeTypes::runtime> ),
-		  tst( daw::json::options::parse_flags<
-		       daw::json::options::CheckedParseMode::no,
-		       daw::json::options::ExecModeTypes::simd> ) };
-
-		auto &result =
-		  *std::min_element( res, res + 3, []( auto const &lhs, auto const &rhs ) {
-			  return lhs.duration_min < rhs.duration_min;
-		  } );
-
-		process_results( result );
-		return result;
+	/***
+	 * Compare the median run time of each result to the most recent result of
+	 * the same name in the baseline
+	 * @return true if at least one result has a baseline and no result is
+	 * slower than its baseline by more than threshold_percent
+	 */
+	bool compare_to_baseline(
+	  std::vector<daw::bench::bench_result> const &results,
+	  std::vector<daw::bench::bench_result> const &baseline,
+	  double threshold_percent ) {
+		bool is_ok = true;
+		std::size_t matched = 0;
+		std::cout << "Comparison to baseline, regression threshold "
+		          << threshold_percent << "%\n";
+		for( auto const &result : results ) {
+			auto const base = std::find_if(
+			  baseline.rbegin( ), baseline.rend( ),
+			  [&]( auto const &b ) { return b.name == result.name; } );
+			if( base == baseline.rend( ) ) {
+				std::cout << "  " << result.name << ": no baseline\n";
+				continue;
+			}
+			++matched;
+			auto const base_time = to_fract( base->duration_50th_percentile );
+			auto const time = to_fract( result.duration_50th_percentile );
+			auto const change = ( ( time - base_time ) / base_time ) * 100.0;
+			bool const is_regression = change > threshold_percent;
+			is_ok = is_ok and not is_regression;
+			std::cout << "  " << result.name << ": "
+			          << base->duration_50th_percentile << " -> "
+			          << result.duration_50th_percentile << " (" << std::showpos
+			          << change << std::noshowpos << "%)"
+			          << ( is_regression ? " REGRESSION" : "" ) << '\n';
+		}
+		if( matched == 0 ) {
+			std::cerr << "No result has a baseline to compare to\n";
+			return false;
+		}
+		return is_ok;
 	}
 } // namespace
 
@@ -514,8 +177,14 @@ int main( int argc, char **argv )
 	std::cout << "Debug build\n";
 #endif
 	if( argc < 5 ) {
-		std::cerr << "Must supply a path to apache_builds.json, twitter.json, "
-		             "citm_catalog.json, and canada.json\n";
+		std::cerr
+		  << "Usage: " << argv[0]
+		  << " apache_builds.json twitter.json citm_catalog.json canada.json "
+		     "[results_file|- [baseline_file [regression_threshold_percent]]]\n"
+		     "The results are appended to results_file, unless it is -.  When a "
+		     "baseline_file is given, the exit status is failure if any median "
+		     "run time is slower than the baseline by more than the threshold, "
+		     "5% by default, or if no result has a baseline\n";
 		exit( 1 );
 	}
 	auto const json_data_apache = *daw::read_file( argv[1] );
@@ -528,48 +197,78 @@ int main( int argc, char **argv )
 	auto const json_data_canada = *daw::read_file( argv[4] );
 	assert( json_data_canada.size( ) > 2 and "Minimum json data size is 2 '{}'" );
 
-	auto const results = std::vector<daw::bench::bench_result>{
-	  do_apache_builds_from_json_test( json_data_apache ),
-	  do_apache_builds_from_json_test_unchecked( json_data_apache ),
-	  do_twitter_from_json_test( json_data_twitter ),
-	  do_twitter_from_json_test_unchecked( json_data_twitter ),
-	  do_citm_from_json_test( json_data_citm ),
-	  do_citm_from_json_test_unchecked( json_data_citm ),
-	  do_canada_from_json_test( json_data_canada ),
-	  do_canada_from_json_test_unchecked( json_data_canada ),
-	  do_nativejson_from_json_test( json_data_twitter, json_data_citm,
-	                                json_data_canada ),
-	  do_nativejson_from_json_test_unchecked( json_data_twitter, json_data_citm,
-	                                          json_data_canada ) };
+	auto results = std::vector<daw::bench::bench_result>( );
+	bench_all_policies(
+	  results, "apache builds",
+	  []( auto parse_policy, std::string const &jd ) {
+		  return daw::json::from_json<apache_builds::apache_builds>( jd,
+		                                                            parse_policy );
+	  },
+	  json_data_apache );
+	bench_all_policies(
+	  results, "twitter",
+	  []( auto parse_policy, std::string const &jd ) {
+		  return daw::json::from_json<daw::twitter::twitter_object_t>(
+		    jd, parse_policy );
+	  },
+	  json_data_twitter );
+	bench_all_policies(
+	  results, "citm catalog",
+	  []( auto parse_policy, std::string const &jd ) {
+		  return daw::json::from_json<daw::citm::citm_object_t>( jd,
+		                                                        parse_policy );
+	  },
+	  json_data_citm );
+	bench_all_policies(
+	  results, "canada",
+	  []( auto parse_policy, std::string const &jd ) {
+		  return daw::json::from_json<daw::geojson::Polygon>(
+		    jd, "features[0].geometry", parse_policy );
+	  },
+	  json_data_canada );
+	bench_all_policies(
+	  results, "nativejson benchmark",
+	  []( auto parse_policy, std::string const &tw, std::string const &ci,
+	      std::string const &ca ) {
+		  auto const j1 =
+		    daw::json::from_json<daw::twitter::twitter_object_t>( tw,
+		                                                          parse_policy );
+		  auto const j2 =
+		    daw::json::from_json<daw::citm::citm_object_t>( ci, parse_policy );
+		  auto const j3 = daw::json::from_json<daw::geojson::Polygon>(
+		    ca, "features[0].geometry", parse_policy );
+		  daw::do_not_optimize( j1 );
+		  daw::do_not_optimize( j2 );
+		  daw::do_not_optimize( j3 );
+	  },
+	  json_data_twitter, json_data_citm, json_data_canada );
 
 	for( auto const &r : results ) {
 		show_result( r );
 		std::cout << '\n';
 		std::cout << '\n';
 	}
-	// std::cout << daw::json::to_json_array( results ) << '\n';
-	if( argc < 6 ) {
-		return EXIT_SUCCESS;
+	if( argc > 5 and std::string_view( argv[5] ) != "-" ) {
+		auto all_results = read_results_file( argv[5] );
+		all_results.insert( all_results.end( ), results.begin( ), results.end( ) );
+		auto const out_data = daw::json::to_json_array( all_results );
+		auto out_file = std::ofstream( argv[5], std::ios::out | std::ios::trunc );
+		assert( out_file );
+		out_file.write( out_data.data( ),
+		                static_cast<std::streamsize>( out_data.size( ) ) );
 	}
-	std::string out_data{ };
-	{
-
-		auto const json_data_results_file = *daw::read_file( argv[5] );
-		auto old_results = [&]( ) -> std::vector<daw::bench::bench_result> {
-			if( json_data_results_file.size( ) < 2U ) {
-				return { };
-			}
-			return daw::json::from_json_array<daw::bench::bench_result>(
-			  json_data_results_file );
-		}( );
-		old_results.insert( old_results.end( ), results.begin( ), results.end( ) );
-		out_data = daw::json::to_json_array( old_results );
+	if( argc > 6 ) {
+		auto const baseline = read_results_file( argv[6] );
+		if( baseline.empty( ) ) {
+			std::cerr << "Baseline file '" << argv[6]
+			          << "' is missing or has no results\n";
+			return EXIT_FAILURE;
+		}
+		double const threshold_percent = argc > 7 ? std::atof( argv[7] ) : 5.0;
+		if( not compare_to_baseline( results, baseline, threshold_percent ) ) {
+			return EXIT_FAILURE;
+		}
 	}
-
-	auto out_file = std::ofstream( argv[5], std::ios::out | std::ios::trunc );
-	assert( out_file );
-	out_file.write( out_data.data( ),
-	                static_cast<std::streamsize>( out_data.size( ) ) );
 }
 #ifdef DAW_USE_EXCEPTIONS
 catch( daw::json::json_exception const &jex ) {
@@ -0,0 +1,151 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_deferred.h>
+#include <daw/json/daw_json_link.h>
+
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+struct Item {
+	int id;
+	std::string name;
+};
+
+struct Envelope {
+	std::string route;
+	daw::json::basic_json_deferred<std::vector<Item>> body;
+	std::optional<daw::json::basic_json_deferred<std::string>> note;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Item> {
+		static constexpr char const id[] = "id";
+		static constexpr char const name[] = "name";
+		using type = json_member_list<json_link<id, int>, json_link<name, std::string>>;
+
+		static constexpr auto to_json_data( Item const &i ) {
+			return std::forward_as_tuple( i.id, i.name );
+		}
+	};
+
+	template<>
+	struct json_data_contract<Envelope> {
+		static constexpr char const route[] = "route";
+		static constexpr char const body[] = "body";
+		static constexpr char const note[] = "note";
+		using type = json_member_list<json_link<route, std::string>,
+		                              json_deferred<body, std::vector<Item>>,
+		                              json_deferred_null<note, std::string>>;
+
+		static constexpr auto to_json_data( Envelope const &e ) {
+			return std::forward_as_tuple( e.route, e.body, e.note );
+		}
+	};
+} // namespace daw::json
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	constexpr std::string_view json_doc =
+	  R"json({"route":"a/b","body":[{"id":1,"name":"x"},{"id":2,"name":"y"},{"id":3,"name":"z"}],"note":"hi"})json";
+
+	auto const env = daw::json::from_json<Envelope>( json_doc );
+	ensure( env.route == "a/b" );
+	ensure( env.body.type( ) == daw::json::JsonBaseParseTypes::Array );
+	ensure( env.body.element_count( ) == 3 );
+	ensure( not env.body.is_parsed( ) );
+
+	// The first access parses and caches, concurrent access is safe
+	auto threads = std::vector<std::thread>( );
+	for( int n = 0; n < 4; ++n ) {
+		threads.emplace_back( [&env] { (void)env.body.get( ); } );
+	}
+	for( auto &t : threads ) {
+		t.join( );
+	}
+	ensure( env.body.is_parsed( ) );
+	auto const *const first_items = &env.body.get( );
+	ensure( first_items == &*env.body );
+	ensure( env.body->size( ) == 3 );
+	ensure( ( *env.body )[2].name == "z" );
+
+	// Strings keep their quotes so that they can be parsed later
+	ensure( env.note and env.note->raw( ) == R"("hi")" );
+	ensure( env.note->get( ) == "hi" );
+
+	// Copies keep the cached value
+	auto const env2 = env;
+	ensure( env2.body.is_parsed( ) );
+	ensure( env2.body->front( ).id == 1 );
+
+	// The body is forwarded as it was received
+	ensure( daw::json::to_json( env ) == json_doc );
+
+	auto const empty = daw::json::from_json<Envelope>(
+	  std::string_view( R"json({"route":"c","body":[ ]})json" ) );
+	ensure( empty.body.element_count( ) == 0 );
+	ensure( empty.body->empty( ) );
+	ensure( not empty.note );
+
+	// Members found out of order are skipped and parsed later, strings whose
+	// contents look like other values keep their quotes
+	auto const out_of_order = daw::json::from_json<Envelope>( std::string_view(
+	  R"json({"note":"null","body":"[1]","route":"d"})json" ) );
+	ensure( out_of_order.route == "d" );
+	ensure( out_of_order.note and out_of_order.note->raw( ) == R"("null")" );
+	ensure( out_of_order.note->get( ) == "null" );
+	ensure( out_of_order.body.type( ) == daw::json::JsonBaseParseTypes::String );
+	ensure( out_of_order.body.raw( ) == R"("[1]")" );
+
+	auto const out_of_order2 = daw::json::from_json<Envelope>( std::string_view(
+	  R"json({"body":[{"id":5,"name":"v"}],"note":null,"route":"e"})json" ) );
+	ensure( out_of_order2.body.element_count( ) == 1 );
+	ensure( out_of_order2.body->front( ).id == 5 );
+	ensure( not out_of_order2.note );
+
+	// Out of order members are counted, not taken from the skip
+	auto const out_of_order3 = daw::json::from_json<Envelope>( std::string_view(
+	  R"json({"body":[{"id":6,"name":"u"},{"id":7,"name":"t"},{"id":8,"name":"s"}],"note":"n","route":"f"})json" ) );
+	ensure( out_of_order3.body.element_count( ) == 3 );
+	ensure( out_of_order3.body->back( ).id == 8 );
+
+	// A root value with known bounds
+	auto const root = daw::json::from_json<
+	  daw::json::json_deferred_no_name<std::vector<int>>, true>(
+	  std::string_view( "[1,2,3]" ) );
+	ensure( root.element_count( ) == 3 );
+	ensure( root->size( ) == 3 and ( *root )[2] == 3 );
+
+	auto const counted = daw::json::basic_json_deferred<std::vector<Item>>(
+	  R"json([{"id":4,"name":"w"}])json", 21 );
+	ensure( counted.element_count( ) == 1 );
+	ensure( counted->front( ).id == 4 );
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
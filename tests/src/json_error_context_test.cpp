@@ -0,0 +1,118 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct Point {
+	int x;
+	int y;
+};
+
+struct Shape {
+	std::string name;
+	std::vector<Point> points;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Point> {
+		static constexpr char const x[] = "x";
+		static constexpr char const y[] = "y";
+		using type = json_member_list<json_link<x, int>, json_link<y, int>>;
+	};
+
+	template<>
+	struct json_data_contract<Shape> {
+		static constexpr char const name[] = "name";
+		static constexpr char const points[] = "points";
+		using type = json_member_list<json_link<name, std::string>,
+		                              json_link<points, std::vector<Point>>>;
+	};
+} // namespace daw::json
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	constexpr auto error_context =
+	  daw::json::options::parse_flags<daw::json::options::ErrorContext::yes>;
+
+	constexpr std::string_view good_doc =
+	  R"json({"name":"tri","points":[{"x":1,"y":2},{"x":3,"y":4}]})json";
+	auto const shape = daw::json::from_json<Shape>( good_doc, error_context );
+	ensure( shape.points.size( ) == 2 );
+	ensure( shape.points[1].y == 4 );
+
+#ifdef DAW_USE_EXCEPTIONS
+	constexpr std::string_view bad_doc = R"json({
+  "name": "tri",
+  "points": [
+    {"x": 1, "y": 2},
+    {"x": 3, "y": 4},
+    {"x": 5, "y": true}
+  ]
+})json";
+	bool has_error = false;
+	try {
+		(void)daw::json::from_json<Shape>( bad_doc, error_context );
+	} catch( daw::json::json_exception const &jex ) {
+		has_error = true;
+		ensure( jex.has_error_context( ) );
+		ensure( jex.path( ) == ".points[2].y" );
+		ensure( jex.document_start( ) == bad_doc.data( ) );
+		ensure( jex.line( ) == 6 );
+		ensure( jex.column( ) > 1 );
+	}
+	ensure( has_error );
+
+	// Elements of a root array
+	has_error = false;
+	try {
+		(void)daw::json::from_json_array<int>( std::string_view( "[1,2,\"3\"]" ),
+		                                       error_context );
+	} catch( daw::json::json_exception const &jex ) {
+		has_error = true;
+		ensure( jex.path( ) == "[2]" );
+		ensure( jex.line( ) == 1 );
+	}
+	ensure( has_error );
+
+	// Without the option no context is recorded
+	has_error = false;
+	try {
+		(void)daw::json::from_json<Shape>( bad_doc );
+	} catch( daw::json::json_exception const &jex ) {
+		has_error = true;
+		ensure( not jex.has_error_context( ) );
+		ensure( jex.path( ).empty( ) );
+		ensure( jex.line( ) == 0 );
+	}
+	ensure( has_error );
+#endif
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,110 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_event_parser.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+struct counting_handler {
+	std::size_t values = 0;
+
+	template<daw::json::json_options_t P, typename A>
+	bool handle_on_value( daw::json::basic_json_pair<P, A> ) {
+		++values;
+		return true;
+	}
+};
+
+std::string make_nested( std::size_t depth ) {
+	auto result = std::string( depth, '[' );
+	result += '1';
+	result.append( depth, ']' );
+	return result;
+}
+
+template<typename StackPolicy>
+bool fails_with_depth_exceeded( std::string_view json_doc, bool use_sax ) {
+#ifdef DAW_USE_EXCEPTIONS
+	try {
+		auto handler = counting_handler{ };
+		if( use_sax ) {
+			daw::json::json_sax_parser<StackPolicy>( json_doc, handler );
+		} else {
+			daw::json::json_event_parser<StackPolicy>( json_doc, handler );
+		}
+	} catch( daw::json::json_exception const &jex ) {
+		return jex.reason_type( ) ==
+		       daw::json::ErrorReason::NestingDepthExceeded;
+	}
+	return false;
+#else
+	(void)json_doc;
+	(void)use_sax;
+	return true;
+#endif
+}
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using fixed_stack_t = daw::json::json_event_parser_fixed_stack<8>;
+	using depth_limit_t = daw::json::json_event_parser_depth_limit<8>;
+
+	constexpr std::string_view json_doc =
+	  R"json({"a":[1,2,{"b":[true,null]}],"c":{"d":"e"}})json";
+
+	auto expected = counting_handler{ };
+	daw::json::json_event_parser( json_doc, expected );
+	ensure( expected.values == 10 );
+
+	auto fixed = counting_handler{ };
+	daw::json::json_event_parser<fixed_stack_t>( json_doc, fixed );
+	ensure( fixed.values == expected.values );
+
+	auto fixed_sax = counting_handler{ };
+	daw::json::json_sax_parser<fixed_stack_t>( json_doc, fixed_sax );
+	ensure( fixed_sax.values == expected.values );
+
+	// Exactly at the limit
+	auto const at_limit = make_nested( 8 );
+	auto at_limit_handler = counting_handler{ };
+	daw::json::json_event_parser<fixed_stack_t>( at_limit, at_limit_handler );
+	ensure( at_limit_handler.values == 9 );
+	daw::json::json_sax_parser<depth_limit_t>( at_limit, at_limit_handler );
+	ensure( at_limit_handler.values == 18 );
+
+	// Past the limit
+	auto const too_deep = make_nested( 9 );
+	ensure( fails_with_depth_exceeded<fixed_stack_t>( too_deep, false ) );
+	ensure( fails_with_depth_exceeded<fixed_stack_t>( too_deep, true ) );
+	ensure( fails_with_depth_exceeded<depth_limit_t>( too_deep, false ) );
+	ensure( fails_with_depth_exceeded<depth_limit_t>( too_deep, true ) );
+	auto const pathological = make_nested( 100'000 );
+	ensure( fails_with_depth_exceeded<fixed_stack_t>( pathological, true ) );
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
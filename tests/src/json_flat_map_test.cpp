@@ -0,0 +1,111 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_flat_map.h>
+#include <daw/json/daw_json_link.h>
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+struct Dictionary {
+	daw::json::json_flat_map<int> values;
+	std::unordered_map<std::string, int> counts;
+	int version;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Dictionary> {
+		static constexpr char const values[] = "values";
+		static constexpr char const counts[] = "counts";
+		static constexpr char const version[] = "version";
+		using type = json_member_list<
+		  json_link<values, json_flat_map<int>>,
+		  json_link<counts, std::unordered_map<std::string, int>>,
+		  json_link<version, int>>;
+
+		static constexpr auto to_json_data( Dictionary const &d ) {
+			return std::forward_as_tuple( d.values, d.counts, d.version );
+		}
+	};
+
+	// Opt in to counting the members before building the map
+	template<>
+	inline constexpr bool
+	  presize_key_value_v<std::unordered_map<std::string, int>> = true;
+} // namespace daw::json
+
+static_assert( daw::json::presize_key_value_v<daw::json::json_flat_map<int>> );
+static_assert(
+  daw::json::presize_key_value_v<std::unordered_map<std::string, int>> );
+static_assert(
+  not daw::json::presize_key_value_v<std::unordered_map<int, int>> );
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	std::string json_doc = R"json({ "values" : { )json";
+	constexpr int key_count = 5000;
+	for( int n = 0; n < key_count; ++n ) {
+		if( n > 0 ) {
+			json_doc += ", ";
+		}
+		json_doc += "\"key" + std::to_string( n ) + "\": " + std::to_string( n );
+	}
+	json_doc += R"json( } , "counts" : {"a":1, "b":2, "a":3} , "version" : 2 })json";
+
+	auto const dict = daw::json::from_json<Dictionary>( json_doc );
+	ensure( dict.version == 2 );
+	ensure( dict.values.size( ) == key_count );
+	for( int n = 0; n < key_count; ++n ) {
+		auto pos = dict.values.find( "key" + std::to_string( n ) );
+		ensure( pos != dict.values.end( ) and pos->second == n );
+	}
+	// Insertion order is kept
+	ensure( dict.values.begin( )->first == "key0" );
+	ensure( not dict.values.contains( "key" ) );
+	// The first of a duplicate key is kept, as with the range constructor
+	ensure( dict.counts.size( ) == 2 );
+	ensure( dict.counts.at( "a" ) == 1 and dict.counts.at( "b" ) == 2 );
+
+	// string_view keys are not unescaped, std::string keys are
+	constexpr std::string_view escaped_doc = R"json({"a\"b": 1, "c": 2})json";
+	auto const raw_keys =
+	  daw::json::from_json<daw::json::json_flat_map<int>>( escaped_doc );
+	ensure( raw_keys.contains( R"(a\"b)" ) );
+	auto const owned_keys =
+	  daw::json::from_json<daw::json::json_flat_map<int, std::string>>(
+	    escaped_doc );
+	ensure( owned_keys.contains( "a\"b" ) );
+
+	auto const empty_map =
+	  daw::json::from_json<daw::json::json_flat_map<int>>( "{}" );
+	ensure( empty_map.empty( ) );
+
+	auto const round_trip = daw::json::to_json( raw_keys );
+	ensure( round_trip == R"json({"a\"b":1,"c":2})json" );
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,110 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_iovec_output.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+struct Payload {
+	std::string name;
+	std::string blob;
+	std::vector<int> values;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Payload> {
+		static constexpr char const name[] = "name";
+		static constexpr char const blob[] = "blob";
+		static constexpr char const values[] = "values";
+		using type = json_member_list<json_link<name, std::string>,
+		                              json_link<blob, std::string>,
+		                              json_link<values, std::vector<int>>>;
+
+		static constexpr auto to_json_data( Payload const &p ) {
+			return std::forward_as_tuple( p.name, p.blob, p.values );
+		}
+	};
+} // namespace daw::json
+
+std::string read_all( int fd ) {
+	ensure( ::lseek( fd, 0, SEEK_SET ) == 0 );
+	auto result = std::string( );
+	char buff[4096];
+	auto count = ::read( fd, buff, sizeof( buff ) );
+	while( count > 0 ) {
+		result.append( buff, static_cast<std::size_t>( count ) );
+		count = ::read( fd, buff, sizeof( buff ) );
+	}
+	ensure( count == 0 );
+	return result;
+}
+
+template<typename Output, typename Value>
+void test_output( Value const &value ) {
+	std::FILE *f = std::tmpfile( );
+	ensure( f != nullptr );
+	int const fd = ::fileno( f );
+	auto out = Output( fd );
+	(void)daw::json::to_json( value, out );
+	out.flush( );
+	auto const expected = daw::json::to_json( value );
+	ensure( out.bytes_written( ) == expected.size( ) );
+	ensure( read_all( fd ) == expected );
+	std::fclose( f );
+}
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	auto payloads = std::vector<Payload>( );
+	payloads.push_back(
+	  Payload{ "large", std::string( 1024U * 1024U, 'x' ), { 1, 2, 3 } } );
+	payloads.push_back(
+	  Payload{ "escaped", "a \"quoted\"\n" + std::string( 5000, 'y' ) + "\t",
+	           { } } );
+	// Multi-byte UTF-8 is part of the unescaped runs and is output unchanged
+	auto snowmen = std::string( );
+	for( int n = 0; n < 2000; ++n ) {
+		snowmen += "\xc3\xa9\xe2\x98\x83";
+	}
+	payloads.push_back( Payload{ "utf8", snowmen, { } } );
+	ensure( daw::json::to_json( snowmen ) == '"' + snowmen + '"' );
+	for( int n = 0; n < 1000; ++n ) {
+		payloads.push_back( Payload{ "small " + std::to_string( n ),
+		                             std::string( static_cast<std::size_t>( n ),
+		                                          'z' ),
+		                             { n, -n } } );
+	}
+	test_output<daw::json::iovec_output>( payloads );
+	test_output<daw::json::basic_iovec_output<64, 16>>( payloads );
+	test_output<daw::json::iovec_output>( payloads.front( ) );
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
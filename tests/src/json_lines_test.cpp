@@ -9,9 +9,11 @@
 #include "defines.h"
 
 #include <daw/json/daw_json_lines_iterator.h>
+#include <daw/json/daw_json_lines_writer.h>
 #include <daw/json/daw_json_link.h>
 
 #include <iterator>
+#include <sstream>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -21,6 +23,11 @@ struct Element {
 	bool b;
 };
 
+struct Tagged {
+	int a;
+	daw::json::json_value payload;
+};
+
 namespace daw::json {
 	template<>
 	struct json_data_contract<Element> {
@@ -41,6 +48,17 @@ namespace daw::json {
 			return std::forward_as_tuple( e.a, e.b );
 		}
 	};
+
+	template<>
+	struct json_data_contract<Tagged> {
+		static constexpr char const a[] = "a";
+		static constexpr char const payload[] = "payload";
+		using type = json_member_list<json_link<a, int>, json_raw<payload>>;
+
+		static constexpr auto to_json_data( Tagged const &t ) {
+			return std::forward_as_tuple( t.a, t.payload );
+		}
+	};
 } // namespace daw::json
 
 int main( ) {
@@ -73,6 +91,53 @@ int main( ) {
 	ensure( elements2[1].a == 2 );
 	ensure( elements2[1].b );
 
+	// Write the lines without a temporary per record
+	using daw::json::options::SerializationFormat;
+	ensure( daw::json::to_json_lines( elements ) == json_lines_result );
+	ensure( daw::json::to_json_lines(
+	          elements,
+	          daw::json::options::output_flags<SerializationFormat::Pretty> ) ==
+	        json_lines_result );
+	ensure( daw::json::to_json_lines<daw::json::json_alt<Element>>( elements ) ==
+	        "[1,false]\n[2,true]\n" );
+
+	auto ss = std::stringstream( );
+	{
+		auto writer = daw::json::json_lines_writer( ss );
+		for( int n = 0; n < 1000; ++n ) {
+			writer.write( Element{ n, n % 2 == 0 } );
+		}
+		writer.flush( );
+		ensure( ss.str( ).size( ) == 19'390 );
+		writer.write( elements[0] );
+	}
+	auto const streamed = ss.str( );
+	ensure( streamed.substr( 0, 17 ) == "{\"a\":0,\"b\":true}\n" );
+	ensure( streamed.substr( streamed.size( ) - 19 ) ==
+	        "{\"a\":1,\"b\":false}\n" );
+
+#ifdef DAW_USE_EXCEPTIONS
+	// A record that fails part way through is not output
+	auto partial = std::string( );
+	{
+		using daw::json::options::RestrictedStringOutput;
+		auto writer = daw::json::json_lines_writer(
+		  partial, daw::json::options::output_flags<
+		             RestrictedStringOutput::OnlyAllow7bitsStrings> );
+		writer.write( Tagged{ 1, daw::json::json_value( "true" ) } );
+		bool has_error = false;
+		try {
+			writer.write( Tagged{ 2, daw::json::json_value( "\"\xc3\xa9\"" ) } );
+		} catch( daw::json::json_exception const & ) {
+			has_error = true;
+		}
+		ensure( has_error );
+		writer.write( Tagged{ 3, daw::json::json_value( "null" ) } );
+	}
+	ensure( partial == "{\"a\":1,\"payload\":true}\n"
+	                   "{\"a\":3,\"payload\":null}\n" );
+#endif
+
 	// Use a tuple to parse
 	constexpr daw::string_view json_lines2 = R"json(
 [1,false]
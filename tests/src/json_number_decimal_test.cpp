@@ -0,0 +1,114 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_decimal.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct Price {
+	std::string symbol;
+	daw::json::json_decimal<4> bid;
+	std::optional<daw::json::json_decimal<4>> ask;
+	daw::json::json_decimal<2> volume;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Price> {
+		static constexpr char const symbol[] = "symbol";
+		static constexpr char const bid[] = "bid";
+		static constexpr char const ask[] = "ask";
+		static constexpr char const volume[] = "volume";
+		using type = json_member_list<
+		  json_string<symbol>,
+		  json_number_decimal<bid, daw::json::json_decimal<4>>,
+		  json_number_decimal_null<ask,
+		                           std::optional<daw::json::json_decimal<4>>>,
+		  json_link<volume, daw::json::json_decimal<2>>>;
+
+		static constexpr auto to_json_data( Price const &p ) {
+			return std::forward_as_tuple( p.symbol, p.bid, p.ask, p.volume );
+		}
+	};
+} // namespace daw::json
+
+static_assert( daw::json::json_decimal<2>( "12.34" ).unscaled( ) == 1234 );
+static_assert( daw::json::json_decimal<2>( "-0.5" ).unscaled( ) == -50 );
+static_assert( daw::json::json_decimal<2>( "1.5e2" ).unscaled( ) == 15000 );
+static_assert( daw::json::json_decimal<2>( "12.340" ).fractional_part( ) ==
+               34 );
+static_assert( daw::json::json_decimal<0>( "-9223372036854775808" ).unscaled( ) ==
+               ( std::numeric_limits<std::int64_t>::min )( ) );
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	constexpr std::string_view json_doc =
+	  R"json({"symbol":"ABC","bid":101.1,"ask":1.01e2,"volume":-0.07})json";
+
+	auto const p = daw::json::from_json<Price>( json_doc );
+	ensure( p.bid.unscaled( ) == 1'011'000 );
+	ensure( p.bid.integral_part( ) == 101 );
+	ensure( p.bid.fractional_part( ) == 1'000 );
+	ensure( p.ask and p.ask->unscaled( ) == 1'010'000 );
+	ensure( p.volume.unscaled( ) == -7 );
+
+	// The values are written with exactly Scale digits after the decimal point
+	ensure(
+	  daw::json::to_json( p ) ==
+	  R"json({"symbol":"ABC","bid":101.1000,"ask":101.0000,"volume":-0.07})json" );
+
+	auto const volumes = daw::json::from_json_array<daw::json::json_decimal<2>>(
+	  std::string_view( "[0,0.1,0.2,9999999999999999.99]" ) );
+	ensure( volumes.size( ) == 4 );
+	ensure( volumes[1].unscaled( ) + volumes[2].unscaled( ) == 30 );
+	ensure( volumes[3].unscaled( ) == 999'999'999'999'999'999 );
+	ensure( daw::json::to_json_array( volumes ) ==
+	        "[0.00,0.10,0.20,9999999999999999.99]" );
+
+	auto const extreme = daw::json::basic_json_decimal<4>::from_unscaled(
+	  ( std::numeric_limits<std::int64_t>::min )( ) );
+	ensure( daw::json::to_json( extreme ) == "-922337203685477.5808" );
+	ensure( daw::json::from_json<daw::json::basic_json_decimal<4>>(
+	          std::string_view( "-922337203685477.5808" ) ) == extreme );
+
+#ifdef DAW_USE_EXCEPTIONS
+	// Not a number, more digits than Scale, or out of the range of Integer
+	for( std::string_view bad : { "\"1.00\"", "01", "1.001", "1e-3",
+	                              "92233720368547758.08", "1e9999999" } ) {
+		bool has_error = false;
+		try {
+			(void)daw::json::from_json<daw::json::json_decimal<2>>( bad );
+		} catch( daw::json::json_exception const & ) { has_error = true; }
+		ensure( has_error );
+	}
+#endif
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
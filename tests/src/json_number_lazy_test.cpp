@@ -0,0 +1,114 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_lazy_number.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+
+struct Metrics {
+	int id;
+	daw::json::json_lazy_number latency;
+	std::optional<daw::json::json_lazy_number> rate;
+	daw::json::json_lazy_number total;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Metrics> {
+		static constexpr char const id[] = "id";
+		static constexpr char const latency[] = "latency";
+		static constexpr char const rate[] = "rate";
+		static constexpr char const total[] = "total";
+		using type = json_member_list<json_link<id, int>, json_number_lazy<latency>,
+		                              json_number_lazy_null<rate>,
+		                              json_link<total, daw::json::json_lazy_number>>;
+
+		static constexpr auto to_json_data( Metrics const &m ) {
+			return std::forward_as_tuple( m.id, m.latency, m.rate, m.total );
+		}
+	};
+} // namespace daw::json
+
+static_assert( daw::json::json_details::split_lazy_number( "-12.5e+3" )
+                 .is_negative );
+static_assert( daw::json::json_details::split_lazy_number( "-12.5e+3" )
+                 .fraction == "5" );
+static_assert( daw::json::json_details::split_lazy_number( "-12.5e+3" )
+                 .exponent == "+3" );
+static_assert( daw::json::json_lazy_number( "42" ).as_int64( ) == 42 );
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	constexpr std::string_view json_doc =
+	  R"json({"id":1,"latency":1.50E+2,"rate":null,"total":123456789012345678901234567890.125})json";
+
+	auto const m = daw::json::from_json<Metrics>( json_doc );
+	ensure( m.id == 1 );
+	ensure( m.latency.raw( ) == "1.50E+2" );
+	ensure( m.latency.as_double( ) == 150.0 );
+	ensure( not m.latency.is_integer( ) );
+	ensure( not m.rate );
+
+	// Digits beyond the range of any arithmetic type are kept
+	auto const parts = m.total.parts( );
+	ensure( not parts.is_negative );
+	ensure( parts.whole == "123456789012345678901234567890" );
+	ensure( parts.fraction == "125" );
+	ensure( parts.exponent.empty( ) );
+
+	// The original characters are written back unchanged, null members are
+	// omitted
+	ensure(
+	  daw::json::to_json( m ) ==
+	  R"json({"id":1,"latency":1.50E+2,"total":123456789012345678901234567890.125})json" );
+
+	auto const m2 = daw::json::from_json<Metrics>(
+	  std::string_view( R"json({"id":2,"latency":-7,"rate":0.25,"total":0})json" ) );
+	ensure( m2.latency.is_integer( ) );
+	ensure( m2.latency.as<std::int32_t>( ) == -7 );
+	ensure( m2.rate and m2.rate->as<float>( ) == 0.25f );
+	ensure( m2.total.as<unsigned>( ) == 0U );
+
+#ifdef DAW_USE_EXCEPTIONS
+	for( std::string_view bad :
+	     { R"json({"id":3,"latency":01,"total":1})json",
+	       R"json({"id":3,"latency":1.,"total":1})json",
+	       R"json({"id":3,"latency":1e,"total":1})json",
+	       R"json({"id":3,"latency":true,"total":1})json",
+	       R"json({"id":3,"latency":"1","total":1})json" } ) {
+		bool has_error = false;
+		try {
+			(void)daw::json::from_json<Metrics>( bad );
+		} catch( daw::json::json_exception const & ) { has_error = true; }
+		ensure( has_error );
+	}
+#endif
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
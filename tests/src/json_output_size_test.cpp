@@ -0,0 +1,88 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+struct Entry {
+	std::string text;
+	double value;
+	std::optional<int> count;
+	std::vector<unsigned> ids;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Entry> {
+		static constexpr char const text[] = "text";
+		static constexpr char const value[] = "value";
+		static constexpr char const count[] = "count";
+		static constexpr char const ids[] = "ids";
+		using type = json_member_list<json_link<text, std::string>,
+		                              json_link<value, double>,
+		                              json_link<count, std::optional<int>>,
+		                              json_link<ids, std::vector<unsigned>>>;
+
+		static constexpr auto to_json_data( Entry const &e ) {
+			return std::forward_as_tuple( e.text, e.value, e.count, e.ids );
+		}
+	};
+} // namespace daw::json
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	ensure( daw::json::to_json_size( 12345 ) == 5 );
+	ensure( daw::json::to_json_size( std::string( "a\"b" ) ) == 6 );
+
+	auto entries = std::vector<Entry>{
+	  { "plain", 1.25, 3, { 1, 20, 300 } },
+	  { "needs \"escaping\"\n\ttabs and \x01 control", -0.001, { }, { } },
+	  { "utf8 \xC3\xA9 \xF0\x9F\x98\x80", 1e300, -42, { 4000000000U } } };
+
+	auto const minified = daw::json::to_json( entries );
+	ensure( daw::json::to_json_size( entries ) == minified.size( ) );
+	auto const exact = daw::json::to_json_exact( entries );
+	ensure( exact == minified );
+
+	using namespace daw::json::options;
+	constexpr auto pretty_flags =
+	  output_flags<SerializationFormat::Pretty, IndentationType::Tab,
+	               NewLineDelimiter::rn,
+	               RestrictedStringOutput::OnlyAllow7bitsStrings>;
+	auto const pretty = daw::json::to_json( entries, pretty_flags );
+	ensure( daw::json::to_json_size( entries, pretty_flags ) == pretty.size( ) );
+	ensure( daw::json::to_json_exact( entries, pretty_flags ) == pretty );
+
+	auto const chars =
+	  daw::json::to_json_exact<daw::json::use_default, std::vector<char>>(
+	    entries.front( ) );
+	auto const front = daw::json::to_json( entries.front( ) );
+	ensure( std::string( chars.data( ), chars.size( ) ) == front );
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
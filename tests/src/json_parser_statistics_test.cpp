@@ -0,0 +1,106 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_parser_statistics.h>
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <typeindex>
+#include <vector>
+
+static_assert( daw::json::parser_statistics_enabled,
+               "DAW_JSON_PARSER_STATISTICS must be defined for this test" );
+
+struct Inner {
+	int x;
+	std::string s;
+};
+
+struct Outer {
+	int a;
+	Inner inner;
+	std::vector<int> values;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Inner> {
+		static constexpr char const x[] = "x";
+		static constexpr char const s[] = "s";
+		using type = json_member_list<json_link<x, int>, json_link<s, std::string>>;
+	};
+
+	template<>
+	struct json_data_contract<Outer> {
+		static constexpr char const a[] = "a";
+		static constexpr char const inner[] = "inner";
+		static constexpr char const values[] = "values";
+		using type = json_member_list<json_link<a, int>, json_link<inner, Inner>,
+		                              json_link<values, std::vector<int>>>;
+	};
+} // namespace daw::json
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	auto json_doc = std::string(
+	  R"({"unknown":[1,2,3],"inner":{"x":2,"s":"esc\"aped"},"a":1,"values":[)" );
+	for( int n = 0; n < 1000; ++n ) {
+		if( n > 0 ) {
+			json_doc += ',';
+		}
+		json_doc += std::to_string( n );
+	}
+	json_doc += "]}";
+
+	daw::json::reset_parser_statistics( );
+	auto const outer = daw::json::from_json<Outer>( json_doc );
+	ensure( outer.values.size( ) == 1000 );
+	ensure( outer.inner.s == "esc\"aped" );
+
+	auto const &stats = daw::json::get_parser_statistics( );
+	auto const outer_stats = stats.find( typeid( Outer ) );
+	ensure( outer_stats != stats.end( ) );
+	ensure( outer_stats->second.classes_parsed == 1 );
+	ensure( outer_stats->second.class_bytes == json_doc.size( ) );
+	ensure( outer_stats->second.unknown_members == 1 );
+	ensure( outer_stats->second.skipped_bytes ==
+	        std::string_view( "[1,2,3]" ).size( ) );
+	// inner is found before a
+	ensure( outer_stats->second.out_of_order_members == 1 );
+	ensure( outer_stats->second.container_reallocations > 0 );
+	ensure( outer_stats->second.escaped_strings == 0 );
+
+	auto const inner_stats = stats.find( typeid( Inner ) );
+	ensure( inner_stats != stats.end( ) );
+	ensure( inner_stats->second.classes_parsed == 1 );
+	ensure( inner_stats->second.escaped_strings == 1 );
+	ensure( inner_stats->second.unknown_members == 0 );
+
+	daw::json::reset_parser_statistics( );
+	ensure( daw::json::get_parser_statistics( ).empty( ) );
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
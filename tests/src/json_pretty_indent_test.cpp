@@ -0,0 +1,139 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_reformat.h>
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+struct Inner {
+	int a;
+	std::vector<int> b;
+};
+
+struct Outer {
+	std::string name;
+	Inner inner;
+	std::map<std::string, int> kv;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Inner> {
+		static constexpr char const a[] = "a";
+		static constexpr char const b[] = "b";
+		using type =
+		  json_member_list<json_link<a, int>, json_link<b, std::vector<int>>>;
+
+		static constexpr auto to_json_data( Inner const &v ) {
+			return std::forward_as_tuple( v.a, v.b );
+		}
+	};
+
+	template<>
+	struct json_data_contract<Outer> {
+		static constexpr char const name[] = "name";
+		static constexpr char const inner[] = "inner";
+		static constexpr char const kv[] = "kv";
+		static constexpr char const key[] = "key";
+		static constexpr char const value[] = "value";
+		using type = json_member_list<
+		  json_link<name, std::string>, json_link<inner, Inner>,
+		  json_key_value_array<kv, std::map<std::string, int>,
+		                       json_link<value, int>, json_link<key, std::string>>>;
+
+		static constexpr auto to_json_data( Outer const &v ) {
+			return std::forward_as_tuple( v.name, v.inner, v.kv );
+		}
+	};
+} // namespace daw::json
+
+/// Build a document of depth nested arrays the way Pretty/Space2 output has it
+std::string nested_arrays( std::size_t depth ) {
+	auto result = std::string( );
+	for( std::size_t n = 0; n < depth; ++n ) {
+		if( n > 0 ) {
+			result += '\n' + std::string( n * 2, ' ' );
+		}
+		result += '[';
+	}
+	result += '\n' + std::string( depth * 2, ' ' ) + '1';
+	for( std::size_t n = depth; n > 0; --n ) {
+		result += '\n' + std::string( ( n - 1 ) * 2, ' ' ) + ']';
+	}
+	return result;
+}
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json::options;
+	auto const value =
+	  Outer{ "n", Inner{ 1, { 2, 3 } }, { { "x", 4 }, { "y", 5 } } };
+
+	auto const minified = daw::json::to_json( value );
+	ensure( minified ==
+	        R"({"name":"n","inner":{"a":1,"b":[2,3]},)"
+	        R"("kv":[{"key":"x","value":4},{"key":"y","value":5}]})" );
+
+	auto const pretty = daw::json::to_json(
+	  value, output_flags<SerializationFormat::Pretty, IndentationType::Space2,
+	                      NewLineDelimiter::rn> );
+	ensure( pretty ==
+	        "{\r\n"
+	        "  \"name\": \"n\",\r\n"
+	        "  \"inner\": {\r\n"
+	        "    \"a\": 1,\r\n"
+	        "    \"b\": [\r\n"
+	        "      2,\r\n"
+	        "      3\r\n"
+	        "    ]\r\n"
+	        "  },\r\n"
+	        "  \"kv\": [\r\n"
+	        "    {\r\n"
+	        "      \"key\": \"x\",\r\n"
+	        "      \"value\": 4\r\n"
+	        "    },\r\n"
+	        "    {\r\n"
+	        "      \"key\": \"y\",\r\n"
+	        "      \"value\": 5\r\n"
+	        "    }\r\n"
+	        "  ]\r\n"
+	        "}" );
+	ensure( daw::json::from_json<Outer>( pretty ).kv == value.kv );
+
+	// Deeper than the precomputed indentation
+	for( std::size_t depth : { 1U, 31U, 32U, 33U, 70U } ) {
+		auto const expected = nested_arrays( depth );
+		auto const minified_doc = daw::json::json_minify( expected );
+		ensure( daw::json::json_reformat(
+		          minified_doc,
+		          output_flags<SerializationFormat::Pretty,
+		                       IndentationType::Space2> ) == expected );
+	}
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
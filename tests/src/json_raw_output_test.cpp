@@ -0,0 +1,112 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <iostream>
+#include <string>
+#include <string_view>
+
+struct Message {
+	std::string id;
+	daw::json::json_value payload;
+	std::string extra;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Message> {
+		static constexpr char const id[] = "id";
+		static constexpr char const payload[] = "payload";
+		static constexpr char const extra[] = "extra";
+		using type = json_member_list<json_link<id, std::string>,
+		                              json_raw<payload>,
+		                              json_raw<extra, std::string>>;
+
+		static constexpr auto to_json_data( Message const &m ) {
+			return std::forward_as_tuple( m.id, m.payload, m.extra );
+		}
+	};
+} // namespace daw::json
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	constexpr std::string_view json_doc =
+	  R"json({"id":"a","payload":{ "x" : [ 1, 2 ], "s" : "q\"é" },"extra":[ true ]})json";
+
+	auto msg = daw::json::from_json<Message>( json_doc );
+	msg.id = "b";
+
+	// Raw members are copied as they were received
+	ensure(
+	  daw::json::to_json( msg ) ==
+	  R"json({"id":"b","payload":{ "x" : [ 1, 2 ], "s" : "q\"é" },"extra":[ true ]})json" );
+
+	// or with their whitespace rewritten to match the output format
+	using daw::json::options::RawValueFormat;
+	using daw::json::options::SerializationFormat;
+	ensure(
+	  daw::json::to_json(
+	    msg, daw::json::options::output_flags<RawValueFormat::Reformat> ) ==
+	  R"json({"id":"b","payload":{"x":[1,2],"s":"q\"é"},"extra":[true]})json" );
+
+	auto const pretty = daw::json::to_json(
+	  msg, daw::json::options::output_flags<SerializationFormat::Pretty,
+	                                        RawValueFormat::Reformat> );
+	ensure( pretty == R"json({
+  "id": "b",
+  "payload": {
+    "x": [
+      1,
+      2
+    ],
+    "s": "q\"é"
+  },
+  "extra": [
+    true
+  ]
+})json" );
+
+	// A json_value that refers to a string keeps its quotes
+	auto const jv = daw::json::json_value( R"json("a\nb")json" );
+	ensure( daw::json::to_json( jv ) == R"json("a\nb")json" );
+
+	// Restricting output to 7 bits keeps the quotes and rejects high bytes
+	using daw::json::options::RestrictedStringOutput;
+	constexpr auto only_7bits = daw::json::options::output_flags<
+	  RestrictedStringOutput::OnlyAllow7bitsStrings>;
+	ensure( daw::json::to_json( jv, only_7bits ) == R"json("a\nb")json" );
+#ifdef DAW_USE_EXCEPTIONS
+	bool has_high_bytes_error = false;
+	try {
+		(void)daw::json::to_json( msg, only_7bits );
+	} catch( daw::json::json_exception const &jex ) {
+		has_high_bytes_error =
+		  jex.reason_type( ) == daw::json::ErrorReason::InvalidStringHighASCII;
+	}
+	ensure( has_high_bytes_error );
+#endif
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,111 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_reformat.h>
+
+#include <cstddef>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+bool fails_with( std::string_view json_doc, daw::json::ErrorReason reason ) {
+#ifdef DAW_USE_EXCEPTIONS
+	try {
+		(void)daw::json::json_minify( json_doc );
+	} catch( daw::json::json_exception const &jex ) {
+		return jex.reason_type( ) == reason;
+	}
+	return false;
+#else
+	(void)json_doc;
+	(void)reason;
+	return true;
+#endif
+}
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	constexpr std::string_view json_doc = R"json(
+	{ "name" : "a \" b" ,
+	  "values": [ 1, -2.5e3 , true,null ] ,
+	  "empty_class" : { },  "empty_array": [ ],
+	  "child" : { "x" : false }
+	}   )json";
+	constexpr std::string_view minified =
+	  R"json({"name":"a \" b","values":[1,-2.5e3,true,null],"empty_class":{},"empty_array":[],"child":{"x":false}})json";
+
+	ensure( daw::json::json_minify( json_doc ) == minified );
+	ensure( daw::json::json_minify( minified ) == minified );
+
+	auto const pretty = daw::json::json_reformat(
+	  json_doc,
+	  daw::json::options::output_flags<
+	    daw::json::options::SerializationFormat::Pretty,
+	    daw::json::options::IndentationType::Space2> );
+	ensure( pretty == R"json({
+  "name": "a \" b",
+  "values": [
+    1,
+    -2.5e3,
+    true,
+    null
+  ],
+  "empty_class": {},
+  "empty_array": [],
+  "child": {
+    "x": false
+  }
+})json" );
+	ensure( daw::json::json_minify( pretty ) == minified );
+
+	// Other outputs
+	auto ss = std::stringstream( );
+	daw::json::json_minify( json_doc, ss );
+	ensure( ss.str( ) == minified );
+
+	char buffer[256]{ };
+	char *last = daw::json::json_minify( json_doc, &buffer[0] );
+	auto const buffer_size = static_cast<std::size_t>( last - buffer );
+	ensure( std::string_view( buffer, buffer_size ) == minified );
+
+	// Larger than the output buffer
+	auto big = std::string( "[ " );
+	for( int n = 0; n < 2000; ++n ) {
+		big += "\"abcdefgh\" , ";
+	}
+	big += "0 ]";
+	auto const big_min = daw::json::json_minify( big );
+	ensure( big_min.size( ) == 2 + 2000 * 11 + 1 );
+	ensure( big_min.substr( 0, 13 ) == R"(["abcdefgh",")" );
+
+	ensure( daw::json::json_minify( std::string_view( " 42 " ) ) == "42" );
+	ensure( fails_with( "[1,2}", daw::json::ErrorReason::InvalidBracketing ) );
+	ensure( fails_with( "[1,2", daw::json::ErrorReason::UnexpectedEndOfData ) );
+	ensure(
+	  fails_with( "{\"a\":1,2}", daw::json::ErrorReason::InvalidMemberName ) );
+	ensure( fails_with( "[1] 2", daw::json::ErrorReason::InvalidEndOfValue ) );
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,145 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_event_parser.h>
+#include <daw/json/daw_json_link.h>
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Records every event so that the output of json_event_parser and
+// json_sax_parser can be compared
+struct recording_handler {
+	std::vector<std::string> events{ };
+	std::string_view skip_name{ };
+
+	template<daw::json::json_options_t P, typename A>
+	daw::json::json_parse_handler_result
+	handle_on_value( daw::json::basic_json_pair<P, A> p ) {
+		events.push_back( "value " + std::string( p.name.value_or( "" ) ) );
+		if( p.name and *p.name == skip_name ) {
+			return daw::json::SkipClassArray;
+		}
+		return daw::json::Continue;
+	}
+
+	template<daw::json::json_options_t P, typename A>
+	bool handle_on_class_start( daw::json::basic_json_value<P, A> ) {
+		events.emplace_back( "{" );
+		return true;
+	}
+
+	bool handle_on_class_end( ) {
+		events.emplace_back( "}" );
+		return true;
+	}
+
+	template<daw::json::json_options_t P, typename A>
+	bool handle_on_array_start( daw::json::basic_json_value<P, A> ) {
+		events.emplace_back( "[" );
+		return true;
+	}
+
+	bool handle_on_array_end( ) {
+		events.emplace_back( "]" );
+		return true;
+	}
+
+	bool handle_on_number( double d ) {
+		events.push_back( "number " + std::to_string( d ) );
+		return true;
+	}
+
+	bool handle_on_bool( bool b ) {
+		events.push_back( b ? "true" : "false" );
+		return true;
+	}
+
+	bool handle_on_string( std::string s ) {
+		events.push_back( "string " + s );
+		return true;
+	}
+
+	bool handle_on_null( ) {
+		events.emplace_back( "null" );
+		return true;
+	}
+};
+
+// Takes strings as std::string_view and stops at the first one
+struct first_string_handler {
+	std::string value{ };
+
+	bool handle_on_string( std::string_view sv ) {
+		value = std::string( sv );
+		return false;
+	}
+};
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	constexpr std::string_view json_doc = R"json(
+{
+	"a": [ 1, -2.5, 1e3, [ [ [ { "deep": [ true, false, null ] } ] ] ] ],
+	"b": { "c": { "d": { "e": "fgé" } }, "skipped": [ 1, 2 ], "h": 3 },
+	"i": [ ],
+	"j": { }
+}
+)json";
+
+	auto event_result = recording_handler{ };
+	daw::json::json_event_parser( json_doc, event_result );
+	auto sax_result = recording_handler{ };
+	daw::json::json_sax_parser( json_doc, sax_result );
+	ensure( not sax_result.events.empty( ) );
+	ensure( sax_result.events == event_result.events );
+	ensure( sax_result.events.front( ) == "value " );
+	ensure( sax_result.events.back( ) == "}" );
+
+	// SkipClassArray skips the rest of the parent class/array
+	auto event_skip = recording_handler{ };
+	event_skip.skip_name = "skipped";
+	daw::json::json_event_parser( json_doc, event_skip );
+	auto sax_skip = recording_handler{ };
+	sax_skip.skip_name = "skipped";
+	daw::json::json_sax_parser( json_doc, sax_skip );
+	ensure( sax_skip.events == event_skip.events );
+	ensure( sax_skip.events.size( ) < sax_result.events.size( ) );
+
+	// Unlike json_event_parser, escaped strings are passed unescaped
+	auto first_string = first_string_handler{ };
+	daw::json::json_sax_parser( R"json([ 1, "a\"b\u00e9", "c" ])json",
+	                            first_string );
+	ensure( first_string.value == "a\"b\xc3\xa9" );
+
+	auto checked = recording_handler{ };
+	daw::json::json_sax_parser( R"([1,[2,3],{"x":4}])", checked,
+	                            daw::json::options::parse_flags<
+	                              daw::json::options::CheckedParseMode::yes> );
+	ensure( checked.events.size( ) == 17 );
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
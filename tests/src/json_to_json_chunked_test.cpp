@@ -0,0 +1,98 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_to_json_chunked.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct Record {
+	int id;
+	std::string name;
+	std::vector<double> values;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Record> {
+		static constexpr char const id[] = "id";
+		static constexpr char const name[] = "name";
+		static constexpr char const values[] = "values";
+		using type = json_member_list<json_link<id, int>,
+		                              json_link<name, std::string>,
+		                              json_link<values, std::vector<double>>>;
+
+		static constexpr auto to_json_data( Record const &r ) {
+			return std::forward_as_tuple( r.id, r.name, r.values );
+		}
+	};
+} // namespace daw::json
+
+template<typename Chunker>
+std::string join_chunks( Chunker &chunker, std::size_t chunk_size ) {
+	auto result = std::string( );
+	while( not chunker.done( ) ) {
+		auto const chunk = chunker.next_chunk( );
+		ensure( not chunk.empty( ) );
+		ensure( chunk.size( ) <= chunk_size );
+		if( not chunker.done( ) ) {
+			ensure( chunk.size( ) == chunk_size );
+		}
+		result.append( chunk.data( ), chunk.size( ) );
+	}
+	ensure( chunker.next_chunk( ).empty( ) );
+	return result;
+}
+
+template<typename Container, typename Flags>
+void test_chunks( Container const &c, Flags flags ) {
+	auto const expected = daw::json::to_json_array( c, flags );
+	for( std::size_t chunk_size : { 1U, 7U, 64U, 4096U, 1000000U } ) {
+		auto chunker = daw::json::to_json_array_chunks( c, chunk_size, flags );
+		ensure( join_chunks( chunker, chunk_size ) == expected );
+	}
+}
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	auto records = std::vector<Record>( );
+	for( int n = 0; n < 500; ++n ) {
+		records.push_back( Record{ n, "record \"" + std::to_string( n ) + "\"",
+		                           { n * 0.5, -n * 1.5 } } );
+	}
+	test_chunks( records, daw::json::options::output_flags<> );
+	test_chunks( records,
+	             daw::json::options::output_flags<
+	               daw::json::options::SerializationFormat::Pretty> );
+	test_chunks( std::vector<Record>( ), daw::json::options::output_flags<> );
+	test_chunks( std::vector<Record>( ),
+	             daw::json::options::output_flags<
+	               daw::json::options::SerializationFormat::Pretty> );
+	test_chunks( std::vector<int>{ 1, 2, 3 },
+	             daw::json::options::output_flags<> );
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
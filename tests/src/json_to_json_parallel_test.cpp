@@ -0,0 +1,87 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_to_json_parallel.h>
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct Record {
+	int id;
+	std::string name;
+	std::vector<double> values;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Record> {
+		static constexpr char const id[] = "id";
+		static constexpr char const name[] = "name";
+		static constexpr char const values[] = "values";
+		using type = json_member_list<json_link<id, int>,
+		                              json_link<name, std::string>,
+		                              json_link<values, std::vector<double>>>;
+
+		static constexpr auto to_json_data( Record const &r ) {
+			return std::forward_as_tuple( r.id, r.name, r.values );
+		}
+	};
+} // namespace daw::json
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	auto records = std::vector<Record>( );
+	for( int n = 0; n < 1003; ++n ) {
+		records.push_back( Record{ n, "name \"" + std::to_string( n ) + '"',
+		                           std::vector<double>( n % 4, n * 0.5 ) } );
+	}
+
+	auto const expected = daw::json::to_json_array( records );
+	ensure( daw::json::to_json_array_parallel( records ) == expected );
+	for( std::size_t threads : { 1U, 2U, 3U, 7U, 2000U } ) {
+		ensure( daw::json::to_json_array_parallel(
+		          records, daw::json::options::output_flags<>, threads ) ==
+		        expected );
+	}
+
+	using namespace daw::json::options;
+	constexpr auto pretty =
+	  output_flags<SerializationFormat::Pretty, IndentationType::Space4>;
+	ensure( daw::json::to_json_array_parallel( records, pretty, 4 ) ==
+	        daw::json::to_json_array( records, pretty ) );
+
+	auto ss = std::stringstream( );
+	daw::json::to_json_array_parallel( records, ss, pretty, 3 );
+	ensure( ss.str( ) == daw::json::to_json_array( records, pretty ) );
+
+	auto const few = std::vector<int>{ 1 };
+	ensure( daw::json::to_json_array_parallel( few, pretty, 4 ) ==
+	        daw::json::to_json_array( few, pretty ) );
+	ensure( daw::json::to_json_array_parallel( std::vector<int>( ) ) == "[]" );
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,194 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_validate.h>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct Order {
+	std::string id;
+	std::uint8_t qty;
+	double price;
+	std::optional<std::string> note;
+	std::chrono::time_point<std::chrono::system_clock, std::chrono::milliseconds>
+	  placed;
+	std::vector<int> tags;
+	std::map<std::string, bool> flags;
+};
+
+struct Strict {
+	int a;
+};
+
+struct Counts {
+	std::map<int, int> by_id;
+};
+
+enum class Level { low, high };
+
+struct Alert {
+	Level level;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Order> {
+		static constexpr char const id[] = "id";
+		static constexpr char const qty[] = "qty";
+		static constexpr char const price[] = "price";
+		static constexpr char const note[] = "note";
+		static constexpr char const placed[] = "placed";
+		static constexpr char const tags[] = "tags";
+		static constexpr char const flags[] = "flags";
+		using type = json_member_list<
+		  json_string<id>,
+		  json_number<qty, std::uint8_t,
+		              options::number_opt(
+		                options::JsonRangeCheck::CheckForNarrowing )>,
+		  json_number<price>, json_string_null<note, std::optional<std::string>>,
+		  json_date<placed>, json_array<tags, int>,
+		  json_key_value<flags, std::map<std::string, bool>, bool>>;
+	};
+
+	template<>
+	struct json_data_contract<Strict> {
+		using exact_class_mapping = void;
+		static constexpr char const a[] = "a";
+		using type = json_member_list<json_number<a, int>>;
+	};
+
+	template<>
+	struct json_enum_names<Level> {
+		static constexpr json_enum_entry<Level> values[] = {
+		  { Level::low, "low" }, { Level::high, "high" } };
+	};
+
+	template<>
+	struct json_data_contract<Alert> {
+		static constexpr char const level[] = "level";
+		using type = json_member_list<json_enum<level, Level>>;
+	};
+
+	template<>
+	struct json_data_contract<Counts> {
+		static constexpr char const by_id[] = "by_id";
+		using type = json_member_list<json_key_value<
+		  by_id, std::map<int, int>, int,
+		  json_number_no_name<int, options::number_opt(
+		                             options::LiteralAsStringOpt::Always )>>>;
+	};
+} // namespace daw::json
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	constexpr std::string_view good = R"json({
+  "tags": [1, 2, 3],
+  "id": "Aé\n☃",
+  "qty": 255,
+  "price": 1.5e3,
+  "placed": "2022-02-03T04:05:06.789Z",
+  "unmapped": {"x": [null]},
+  "flags": {"rush": true, "gift": false}
+})json";
+
+	// The document is accepted and is what from_json would parse
+	daw::json::json_ensure_valid<Order>( good );
+	auto const order = daw::json::from_json<Order>( good );
+	ensure( order.qty == 255 );
+	ensure( not order.note );
+
+#ifdef DAW_USE_EXCEPTIONS
+	ensure( daw::json::json_validate<Order>( good ) );
+	ensure( daw::json::json_validate<std::vector<int>>(
+	  std::string_view( "[ 1, -2, 3 ]" ) ) );
+	ensure(
+	  daw::json::json_validate<Strict>( std::string_view( R"({"a":1})" ) ) );
+
+	auto const reason_for = []( std::string_view json_doc ) {
+		try {
+			daw::json::json_ensure_valid<Order>( json_doc );
+		} catch( daw::json::json_exception const &jex ) {
+			return jex.reason_type( );
+		}
+		return daw::json::ErrorReason::Unknown;
+	};
+	using daw::json::ErrorReason;
+	constexpr std::string_view tail =
+	  R"(,"price":1,"placed":"2022-02-03T04:05:06Z","tags":[],"flags":{}})";
+	auto const with = [&]( std::string_view first_members ) {
+		return std::string( first_members ) + std::string( tail );
+	};
+	// Required member missing
+	ensure( reason_for( with( R"({"id":"a")" ) ) == ErrorReason::MemberNotFound );
+	// Out of range for std::uint8_t
+	ensure( reason_for( with( R"({"id":"a","qty":256)" ) ) ==
+	        ErrorReason::NumberOutOfRange );
+	// Wrong type
+	ensure( reason_for( with( R"({"id":1,"qty":1)" ) ) ==
+	        ErrorReason::InvalidString );
+	// Bad escape and invalid UTF-8
+	ensure( reason_for( with( R"({"id":"\uZZZZ","qty":1)" ) ) ==
+	        ErrorReason::InvalidUTFEscape );
+	ensure( reason_for( with( "{\"id\":\"\xc0\xaf\",\"qty\":1" ) ) ==
+	        ErrorReason::InvalidUTFCodepoint );
+	ensure( reason_for( with( "{\"id\":\"\xed\xa0\x80\",\"qty\":1" ) ) ==
+	        ErrorReason::InvalidUTFCodepoint );
+	// Malformed timestamp
+	ensure( not daw::json::json_validate<Order>( std::string_view(
+	  R"({"id":"a","qty":1,"price":1,"placed":"yesterday","tags":[]})" ) ) );
+	// Trailing data and structural errors
+	ensure( not daw::json::json_validate<std::vector<int>>(
+	  std::string_view( "[1,2] 3" ) ) );
+	ensure( not daw::json::json_validate<std::vector<int>>(
+	  std::string_view( "[1,2,]" ) ) );
+	ensure( not daw::json::json_validate<std::vector<int>>(
+	  std::string_view( "[1,2" ) ) );
+	// Unknown members are errors for exact mappings
+	ensure( not daw::json::json_validate<Strict>(
+	  std::string_view( R"({"a":1,"b":2})" ) ) );
+	// Key/value names must parse as the key type
+	constexpr std::string_view good_counts = R"({"by_id":{"1":2,"30":4}})";
+	ensure( daw::json::json_validate<Counts>( good_counts ) );
+	ensure( daw::json::from_json<Counts>( good_counts ).by_id.at( 30 ) == 4 );
+	ensure( not daw::json::json_validate<Counts>(
+	  std::string_view( R"({"by_id":{"1":2,"abc":4}})" ) ) );
+	ensure( not daw::json::json_validate<Counts>(
+	  std::string_view( R"({"by_id":{"1":"2"}})" ) ) );
+	// Custom members are checked by their converter
+	ensure( daw::json::json_validate<Alert>(
+	  std::string_view( R"({"level":"high"})" ) ) );
+	ensure( not daw::json::json_validate<Alert>(
+	  std::string_view( R"({"level":"medium"})" ) ) );
+#endif
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif